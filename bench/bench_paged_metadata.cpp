@@ -0,0 +1,193 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+/*
+ * Open-plus-attribute-scan benchmark of the paged aggregation file space
+ * strategy.
+ *
+ * Two files with the same content are written: one with the default file
+ * space strategy, one with paged aggregation. Each section group holds a set
+ * of attributes and a raw data dataset, so metadata and raw data are
+ * interleaved in the default file. Afterwards, the files are evicted from the
+ * page cache, opened and all attributes are read. With paged aggregation and
+ * a page buffer, the metadata is read in a few large page reads.
+ *
+ * Usage: bench_paged_metadata [groups] [attributes per group] [repetitions]
+ */
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include "PLIHDF5/plihdf5.h"
+
+struct BenchConfig {
+    size_t numGroups = 500;
+    size_t attributesPerGroup = 16;
+    size_t repetitions = 5;
+    size_t rawBytesPerGroup = 256 * 1024;
+    size_t pageSize = 64 * 1024;
+    size_t pageBufferSize = 4 * 1024 * 1024;
+};
+
+void writeBenchFile(const std::string &path, const BenchConfig &config,
+                    const bool paged) {
+    PLI::HDF5::FileCreateOptions createOptions;
+    if (paged) {
+        createOptions.pagedAggregation = true;
+        createOptions.pageSize = config.pageSize;
+    }
+    auto file = PLI::HDF5::createFile(
+        path, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        PLI::HDF5::FileAccessOptions{}, createOptions);
+
+    const size_t numValues = config.rawBytesPerGroup / sizeof(float);
+    const std::vector<float> rawData(numValues, 1.0f);
+    for (size_t i = 0; i < config.numGroups; ++i) {
+        auto group = file.createGroup("section_" + std::to_string(i));
+        PLI::HDF5::AttributeHandler handler(group);
+        for (size_t j = 0; j < config.attributesPerGroup; ++j) {
+            if (j % 2 == 0) {
+                handler.createAttribute<double>("value_" + std::to_string(j),
+                                                static_cast<double>(i * j));
+            } else {
+                handler.createAttribute<std::string>(
+                    "name_" + std::to_string(j),
+                    "section " + std::to_string(i) + " / " +
+                        std::to_string(j));
+            }
+        }
+        auto dataset = group.createDataset<float>("data", {numValues});
+        dataset.write(rawData, {0}, {numValues});
+        dataset.close();
+        group.close();
+    }
+    file.flush();
+    file.close();
+}
+
+void dropFromPageCache(const std::string &path) {
+    // Only clean pages can be evicted, so sync the file first. Without
+    // permission to evict, the benchmark measures the warm page cache.
+    int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return;
+    }
+    ::fdatasync(fd);
+    ::posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+    ::close(fd);
+}
+
+size_t scanBenchFile(const std::string &path, const BenchConfig &config,
+                     const bool pageBuffer) {
+    PLI::HDF5::FileAccessOptions accessOptions;
+    if (pageBuffer) {
+        accessOptions.pageBufferSize = config.pageBufferSize;
+    }
+    auto file = PLI::HDF5::openFile(
+        path, PLI::HDF5::File::OpenState::ReadOnly, {}, accessOptions);
+
+    size_t numRead = 0;
+    for (size_t i = 0; i < config.numGroups; ++i) {
+        auto group = file.openGroup("section_" + std::to_string(i));
+        PLI::HDF5::AttributeHandler handler(group);
+        for (const auto &name : handler.attributeNames()) {
+            if (name.starts_with("value_")) {
+                numRead += handler.getAttribute<double>(name).size();
+            } else {
+                numRead += handler.getAttribute<std::string>(name).size();
+            }
+        }
+        group.close();
+    }
+    file.close();
+    return numRead;
+}
+
+double medianMilliseconds(std::vector<double> times) {
+    std::sort(times.begin(), times.end());
+    return times[times.size() / 2];
+}
+
+int main(int argc, char *argv[]) {
+    BenchConfig config;
+    if (argc > 1) {
+        config.numGroups = std::stoul(argv[1]);
+    }
+    if (argc > 2) {
+        config.attributesPerGroup = std::stoul(argv[2]);
+    }
+    if (argc > 3) {
+        config.repetitions = std::max<size_t>(1, std::stoul(argv[3]));
+    }
+
+    const std::filesystem::path directory =
+        std::filesystem::temp_directory_path();
+    const std::string defaultPath = directory / "bench_default_fspace.h5";
+    const std::string pagedPath = directory / "bench_paged_fspace.h5";
+    writeBenchFile(defaultPath, config, false);
+    writeBenchFile(pagedPath, config, true);
+
+    struct Case {
+        std::string name;
+        std::string path;
+        bool pageBuffer;
+    };
+    const std::vector<Case> cases = {
+        {"default", defaultPath, false},
+        {"paged", pagedPath, false},
+        {"paged + page buffer", pagedPath, true}};
+
+    std::cout << config.numGroups << " groups, " << config.attributesPerGroup
+              << " attributes per group, median of " << config.repetitions
+              << " runs" << std::endl;
+    for (const auto &benchCase : cases) {
+        std::vector<double> times;
+        for (size_t r = 0; r < config.repetitions; ++r) {
+            dropFromPageCache(benchCase.path);
+            auto start = std::chrono::steady_clock::now();
+            scanBenchFile(benchCase.path, config, benchCase.pageBuffer);
+            auto end = std::chrono::steady_clock::now();
+            times.push_back(
+                std::chrono::duration<double, std::milli>(end - start)
+                    .count());
+        }
+        std::cout << benchCase.name << ": " << medianMilliseconds(times)
+                  << " ms (file size "
+                  << std::filesystem::file_size(benchCase.path) / 1024
+                  << " KiB)" << std::endl;
+    }
+
+    std::filesystem::remove(defaultPath);
+    std::filesystem::remove(pagedPath);
+    return EXIT_SUCCESS;
+}
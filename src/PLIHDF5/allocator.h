@@ -0,0 +1,92 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Allocator which default-initializes instead of value-initializing.
+ *
+ * Resizing a std::vector with this allocator leaves elements of trivial types
+ * uninitialized instead of setting them to zero. This avoids touching the
+ * memory twice when the vector is filled by a read directly afterwards.
+ * @tparam T Type of the elements.
+ * @tparam Base Allocator used for the allocation.
+ */
+template <typename T, typename Base = std::allocator<T>>
+class DefaultInitAllocator : public Base {
+    using Traits = std::allocator_traits<Base>;
+
+  public:
+    template <typename U> struct rebind {
+        using other =
+            DefaultInitAllocator<U, typename Traits::template rebind_alloc<U>>;
+    };
+
+    using Base::Base;
+
+    /**
+     * @brief Default-initialize an element.
+     * @param ptr Pointer to the uninitialized element.
+     */
+    template <typename U>
+    void
+    construct(U *ptr) noexcept(std::is_nothrow_default_constructible_v<U>) {
+        ::new (static_cast<void *>(ptr)) U;
+    }
+
+    /**
+     * @brief Construct an element from the given arguments.
+     * @param ptr Pointer to the uninitialized element.
+     * @param args Arguments passed to the constructor.
+     */
+    template <typename U, typename... Args>
+    void construct(U *ptr, Args &&...args) {
+        Traits::construct(static_cast<Base &>(*this), ptr,
+                          std::forward<Args>(args)...);
+    }
+};
+
+/**
+ * @brief Vector whose elements are not zeroed when resizing.
+ * @tparam T Type of the elements.
+ */
+template <typename T>
+using DefaultInitVector = std::vector<T, DefaultInitAllocator<T>>;
+} // namespace HDF5
+} // namespace PLI
@@ -0,0 +1,172 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <future>
+#include <map>
+#include <mutex>
+#include <thread>
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Completion handle of an asynchronous operation.
+ *
+ * Returned by PLI::HDF5::Dataset::writeAsync. Copies of a handle refer to the
+ * same operation.
+ */
+class IOHandle {
+  public:
+    /**
+     * @brief Construct an empty handle which does not refer to an operation.
+     */
+    IOHandle() noexcept = default;
+    explicit IOHandle(std::shared_future<void> future) noexcept;
+
+    /**
+     * @brief Returns if the handle refers to an operation.
+     * @return true Handle refers to an operation.
+     * @return false Handle is empty.
+     */
+    bool valid() const noexcept;
+    /**
+     * @brief Returns if the operation is finished, without blocking.
+     * @return true Operation is finished, wait() returns immediately.
+     * @return false Operation is still queued or running.
+     */
+    bool ready() const;
+    /**
+     * @brief Wait until the operation is finished.
+     *
+     * Exceptions thrown by the operation are rethrown here, e.g.
+     * PLI::HDF5::Exceptions::HDF5RuntimeException if the write failed.
+     * Waiting on an empty handle returns immediately.
+     */
+    void wait() const;
+
+  private:
+    std::shared_future<void> m_future;
+};
+
+/**
+ * @brief Queue executing HDF5 operations on a dedicated I/O thread.
+ *
+ * Operations are executed one after another in the order they were
+ * submitted, so collective operations of all processes match as long as each
+ * process submits them in the same order. The thread is started with the
+ * first submitted operation and finishes the remaining operations before the
+ * program exits.
+ *
+ * Operations are only executed on the I/O thread if the HDF5 library was
+ * built thread-safe, so the caller can use HDF5 while they are pending.
+ * Otherwise, they are executed on the calling thread when they are
+ * submitted.
+ */
+class IOQueue {
+  public:
+    /**
+     * @brief Returns the queue of this process.
+     * @return IOQueue* Process-wide queue.
+     */
+    static IOQueue *getInstance();
+    /**
+     * @brief Destroy the IOQueue object
+     * Finishes all pending operations and stops the I/O thread.
+     */
+    ~IOQueue();
+
+    /**
+     * @brief Submit an operation.
+     *
+     * The operation and everything it captured is destroyed on the I/O thread
+     * while holding the HDF5 lock, so it can safely own HDF5 objects.
+     * @param fileID File the operation belongs to. Used by waitAll. The
+     * queue holds a reference to it until the operation is finished.
+     * @param operation Operation to execute.
+     * @param background If false, the operation is executed on the calling
+     * thread, e.g. if MPI does not allow MPI calls from other threads. This
+     * is also done if the HDF5 library is not thread-safe.
+     * @return IOHandle Handle to wait for the operation.
+     */
+    IOHandle submit(const hid_t fileID, std::function<void()> operation,
+                    const bool background = true);
+    /**
+     * @brief Wait until all operations of a file are finished.
+     *
+     * Errors are not reported here but by the handle of each operation.
+     * @param fileID File identifier passed to submit.
+     */
+    void waitAll(const hid_t fileID);
+    /**
+     * @brief Wait until all operations are finished.
+     */
+    void waitAll();
+    /**
+     * @brief Lock the HDF5 library against the I/O thread.
+     * @return std::unique_lock<std::mutex> Lock, which is held until it is
+     * destroyed.
+     */
+    std::unique_lock<std::mutex> lockHDF5();
+
+  private:
+    IOQueue() = default;
+    IOQueue(const IOQueue &) = delete;
+    IOQueue(IOQueue &&) = delete;
+    IOQueue &operator=(const IOQueue &) = delete;
+    IOQueue &operator=(IOQueue &&) = delete;
+
+    struct Operation {
+        hid_t fileID;
+        std::function<void()> function;
+        std::promise<void> promise;
+    };
+
+    void run();
+    void execute(Operation &operation);
+
+    std::mutex m_mutex;
+    std::condition_variable m_operationAdded;
+    std::condition_variable m_operationFinished;
+    std::deque<Operation> m_operations;
+    std::map<hid_t, size_t> m_pending;
+    std::thread m_thread;
+    bool m_stop = false;
+    std::mutex m_hdf5Mutex;
+};
+} // namespace HDF5
+} // namespace PLI
@@ -61,7 +61,6 @@ const std::vector<T> PLI::HDF5::AttributeHandler::getAttribute(
   hid_t attributeID = H5Aopen(this->m_id, attributeName.c_str(), H5P_DEFAULT);
   checkHDF5Ptr(attributeID, "H5Aopen");
   hid_t _attributeType = PLI::HDF5::Type::createType<T>();
-  checkHDF5Ptr(_attributeType, "PLI::HDF5::Type");
   hid_t attributeSpace = H5Aget_space(attributeID);
   checkHDF5Ptr(attributeSpace, "H5Aget_space");
   int ndims = H5Sget_simple_extent_ndims(attributeSpace);
@@ -0,0 +1,187 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <span>
+#include <vector>
+
+#include "PLIHDF5/chunkgrid.h"
+#include "PLIHDF5/dataset.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Collects small writes to a dataset and writes whole chunks.
+ *
+ * Writing parts of a compressed chunk, e.g. one image row at a time, makes
+ * HDF5 decompress, patch and compress the whole chunk for every write. The
+ * writer copies the written elements into one buffer per chunk instead. As
+ * soon as all elements of a chunk were written, the chunk is written with one
+ * aligned call.
+ *
+ * If the buffers exceed the memory limit, the oldest incomplete chunk is
+ * flushed. Incomplete chunks are completed with the current content of the
+ * dataset (read-modify-write), or with its fill value if no storage was
+ * allocated yet, and written as a whole as well. All buffered chunks are
+ * flushed by flush() and when the writer is destroyed.
+ *
+ * The memory limit should hold all chunks touched by one write, e.g. one row
+ * of chunks when writing image rows. Otherwise, chunks are flushed before
+ * they are complete and every write becomes a read-modify-write of the
+ * chunks it touches.
+ *
+ * The chunks are written with TransferMode::Independent. With MPI, each
+ * chunk should only be written by one process, otherwise the
+ * read-modify-write of incomplete chunks may overwrite elements of other
+ * processes.
+ * @tparam T Type of the elements.
+ */
+template <typename T> class BufferedWriter {
+  public:
+    /// Default memory limit of the buffered chunks in bytes.
+    static constexpr size_t DEFAULT_MEMORY_LIMIT = size_t{256} << 20;
+
+    /**
+     * @brief Construct a new BufferedWriter object
+     * @param dataset Dataset to write to.
+     * @param memoryLimit Maximum number of bytes of all buffered chunks. It
+     * should cover one row of chunks for row-wise writes. A single chunk is
+     * always buffered, even if it exceeds the limit.
+     * @param chunkDims Dimensions of the buffered blocks. If empty, the chunk
+     * dimensions of the dataset are used.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the
+     * dataset is invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If no chunk
+     * dimensions are given and the dataset is not chunked, or if the fill
+     * value of the dataset could not be read.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the chunk
+     * dimensions do not match the dataset.
+     */
+    explicit BufferedWriter(const Dataset &dataset,
+                            const size_t memoryLimit = DEFAULT_MEMORY_LIMIT,
+                            const std::vector<size_t> &chunkDims = {});
+    BufferedWriter(const BufferedWriter &) = delete;
+    BufferedWriter(BufferedWriter &&) = delete;
+    BufferedWriter &operator=(const BufferedWriter &) = delete;
+    BufferedWriter &operator=(BufferedWriter &&) = delete;
+    /**
+     * @brief Destroy the BufferedWriter object
+     * Flushes all buffered chunks. Errors are ignored, call flush() before to
+     * handle them.
+     */
+    ~BufferedWriter();
+
+    /**
+     * @brief Write data to an area of the dataset.
+     *
+     * The data is copied into the buffers of the chunks touched by the
+     * hyperslab. Chunks which are complete afterwards are written to the
+     * dataset.
+     * @param data Data of the hyperslab in row-major order.
+     * @param hyperslab Area of the dataset. The stride has to be 1.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * hyperslab does not match the dataset or the data size does not match
+     * the hyperslab.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a chunk could
+     * not be written.
+     */
+    void write(std::span<const T> data, const Dataset::Hyperslab &hyperslab);
+
+    /**
+     * @brief Write data to an area of the dataset.
+     *
+     * See write(std::span<const T>, const Dataset::Hyperslab&).
+     * @param data Data of the hyperslab in row-major order.
+     * @param hyperslab Area of the dataset. The stride has to be 1.
+     */
+    void write(const std::vector<T> &data,
+               const Dataset::Hyperslab &hyperslab);
+
+    /**
+     * @brief Write all buffered chunks to the dataset.
+     *
+     * Incomplete chunks are completed with the current content of the
+     * dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a chunk could
+     * not be written.
+     */
+    void flush();
+
+    /**
+     * @brief Returns the number of chunks which are currently buffered.
+     * @return size_t Number of chunks.
+     */
+    size_t bufferedChunks() const noexcept;
+
+    /**
+     * @brief Returns the memory used by the buffered chunks.
+     * @return size_t Number of bytes.
+     */
+    size_t bufferedBytes() const noexcept;
+
+    /**
+     * @brief Returns the grid of the buffered chunks.
+     * @return const ChunkGrid& Chunk grid.
+     */
+    const ChunkGrid &grid() const noexcept;
+
+  private:
+    /// Buffer of one chunk.
+    struct Block {
+        /// Elements of the chunk in row-major order.
+        std::vector<T> data;
+        /// Elements which were written.
+        std::vector<bool> written;
+        /// Number of elements which were written.
+        size_t numWritten{0};
+        /// Order in which the blocks were created, used for eviction.
+        uint64_t sequence{0};
+    };
+
+    Block &block(size_t index);
+    void flushBlock(size_t index);
+
+    Dataset m_dataset;
+    ChunkGrid m_grid;
+    size_t m_memoryLimit;
+    T m_fillValue;
+    std::map<size_t, Block> m_blocks;
+    size_t m_bufferedBytes;
+    uint64_t m_sequence;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/bufferedwriter.tpp"
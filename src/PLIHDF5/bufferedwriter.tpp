@@ -0,0 +1,260 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+
+#include "PLIHDF5/bufferedwriter.h"
+#include "PLIHDF5/exceptions.h"
+
+template <typename T>
+PLI::HDF5::BufferedWriter<T>::BufferedWriter(
+    const Dataset &dataset, const size_t memoryLimit,
+    const std::vector<size_t> &chunkDims)
+    : m_dataset(dataset),
+      m_grid(chunkDims.empty() ? dataset.chunkGrid()
+                               : dataset.chunkGrid(chunkDims)),
+      m_memoryLimit(memoryLimit), m_fillValue(), m_bufferedBytes(0),
+      m_sequence(0) {
+    // Elements which were never written have the fill value of the dataset.
+    hid_t plist = H5Dget_create_plist(m_dataset);
+    checkHDF5Ptr(plist, "H5Dget_create_plist");
+    H5D_fill_value_t fillValue;
+    herr_t status = H5Pfill_value_defined(plist, &fillValue);
+    if (status >= 0 && fillValue == H5D_FILL_VALUE_USER_DEFINED) {
+        status = H5Pget_fill_value(plist, PLI::HDF5::Type::createType<T>(),
+                                   &m_fillValue);
+    }
+    checkHDF5Call(H5Pclose(plist), "H5Pclose");
+    checkHDF5Call(status, "H5Pget_fill_value");
+}
+
+template <typename T> PLI::HDF5::BufferedWriter<T>::~BufferedWriter() {
+    try {
+        flush();
+    } catch (...) {
+        // Destructors must not throw. Call flush() to handle errors.
+    }
+}
+
+template <typename T>
+void PLI::HDF5::BufferedWriter<T>::write(
+    std::span<const T> data, const Dataset::Hyperslab &hyperslab) {
+    const size_t ndims = m_grid.ndims();
+    const auto &offset = hyperslab.offset();
+    const auto &count = hyperslab.count();
+    const auto &stride = hyperslab.stride();
+    if (offset.size() != ndims || count.size() != ndims) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Hyperslab must have the same number of dimensions as the "
+            "dataset.");
+    }
+    if (std::any_of(stride.begin(), stride.end(),
+                    [](const hsize_t step) { return step != 1; })) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "BufferedWriter only supports hyperslabs with a stride of 1.");
+    }
+    for (size_t i = 0; i < ndims; ++i) {
+        if (offset[i] + count[i] > m_grid.dims()[i]) {
+            throw PLI::HDF5::Exceptions::DimensionMismatchException(
+                "Hyperslab exceeds the dimensions of the dataset.");
+        }
+    }
+    const size_t numElements =
+        std::accumulate(count.begin(), count.end(), size_t{1},
+                        std::multiplies<size_t>());
+    if (data.size() != numElements) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Data size does not match the hyperslab.");
+    }
+    if (numElements == 0) {
+        return;
+    }
+
+    // Range of chunk coordinates touched by the hyperslab.
+    const auto &chunkDims = m_grid.chunkDims();
+    std::vector<size_t> firstChunk(ndims);
+    std::vector<size_t> lastChunk(ndims);
+    for (size_t i = 0; i < ndims; ++i) {
+        firstChunk[i] = offset[i] / chunkDims[i];
+        lastChunk[i] = (offset[i] + count[i] - 1) / chunkDims[i];
+    }
+
+    std::vector<size_t> chunkCoordinates = firstChunk;
+    std::vector<size_t> begin(ndims);
+    std::vector<size_t> end(ndims);
+    std::vector<size_t> position(ndims);
+    while (true) {
+        const size_t index = m_grid.chunkIndex(chunkCoordinates);
+        const Dataset::Hyperslab chunk = m_grid[index];
+        const auto &chunkOffset = chunk.offset();
+        const auto &chunkCount = chunk.count();
+        Block &target = block(index);
+
+        // Intersection of the hyperslab and the chunk.
+        for (size_t i = 0; i < ndims; ++i) {
+            begin[i] = std::max<size_t>(offset[i], chunkOffset[i]);
+            end[i] = std::min<size_t>(offset[i] + count[i],
+                                      chunkOffset[i] + chunkCount[i]);
+        }
+
+        // Copy the intersection row by row along the last dimension.
+        const size_t rowLength = end[ndims - 1] - begin[ndims - 1];
+        position = begin;
+        while (true) {
+            size_t source = 0;
+            size_t destination = 0;
+            for (size_t i = 0; i < ndims; ++i) {
+                source = source * count[i] + (position[i] - offset[i]);
+                destination = destination * chunkCount[i] +
+                              (position[i] - chunkOffset[i]);
+            }
+            std::copy_n(data.begin() + source, rowLength,
+                        target.data.begin() + destination);
+            for (size_t i = destination; i < destination + rowLength; ++i) {
+                if (!target.written[i]) {
+                    target.written[i] = true;
+                    ++target.numWritten;
+                }
+            }
+
+            size_t dim = ndims - 1;
+            while (dim > 0 && ++position[dim - 1] == end[dim - 1]) {
+                position[dim - 1] = begin[dim - 1];
+                --dim;
+            }
+            if (dim == 0) {
+                break;
+            }
+        }
+
+        if (target.numWritten == target.data.size()) {
+            flushBlock(index);
+        }
+
+        size_t dim = ndims;
+        while (dim > 0 && ++chunkCoordinates[dim - 1] > lastChunk[dim - 1]) {
+            chunkCoordinates[dim - 1] = firstChunk[dim - 1];
+            --dim;
+        }
+        if (dim == 0) {
+            return;
+        }
+    }
+}
+
+template <typename T>
+void PLI::HDF5::BufferedWriter<T>::write(
+    const std::vector<T> &data, const Dataset::Hyperslab &hyperslab) {
+    this->write(std::span<const T>(data), hyperslab);
+}
+
+template <typename T> void PLI::HDF5::BufferedWriter<T>::flush() {
+    while (!m_blocks.empty()) {
+        flushBlock(m_blocks.begin()->first);
+    }
+}
+
+template <typename T>
+size_t PLI::HDF5::BufferedWriter<T>::bufferedChunks() const noexcept {
+    return m_blocks.size();
+}
+
+template <typename T>
+size_t PLI::HDF5::BufferedWriter<T>::bufferedBytes() const noexcept {
+    return m_bufferedBytes;
+}
+
+template <typename T>
+const PLI::HDF5::ChunkGrid &
+PLI::HDF5::BufferedWriter<T>::grid() const noexcept {
+    return m_grid;
+}
+
+template <typename T>
+typename PLI::HDF5::BufferedWriter<T>::Block &
+PLI::HDF5::BufferedWriter<T>::block(const size_t index) {
+    auto it = m_blocks.find(index);
+    if (it != m_blocks.end()) {
+        return it->second;
+    }
+
+    const auto &chunkCount = m_grid[index].count();
+    const size_t numElements =
+        std::accumulate(chunkCount.begin(), chunkCount.end(), size_t{1},
+                        std::multiplies<size_t>());
+    const size_t numBytes = numElements * sizeof(T);
+
+    // Make room by flushing the oldest chunks.
+    while (!m_blocks.empty() && m_bufferedBytes + numBytes > m_memoryLimit) {
+        const auto oldest = std::min_element(
+            m_blocks.begin(), m_blocks.end(),
+            [](const auto &lhs, const auto &rhs) {
+                return lhs.second.sequence < rhs.second.sequence;
+            });
+        flushBlock(oldest->first);
+    }
+
+    Block &newBlock = m_blocks[index];
+    newBlock.data.resize(numElements);
+    newBlock.written.resize(numElements, false);
+    newBlock.sequence = m_sequence++;
+    m_bufferedBytes += numBytes;
+    return newBlock;
+}
+
+template <typename T>
+void PLI::HDF5::BufferedWriter<T>::flushBlock(const size_t index) {
+    auto it = m_blocks.find(index);
+    if (it == m_blocks.end()) {
+        return;
+    }
+    Block &target = it->second;
+    const Dataset::Hyperslab chunk = m_grid[index];
+
+    // Complete partially written chunks with the content of the dataset.
+    if (target.numWritten < target.data.size()) {
+        H5D_space_status_t spaceStatus;
+        checkHDF5Call(H5Dget_space_status(m_dataset, &spaceStatus),
+                      "H5Dget_space_status");
+        // HDF5 cannot read a dataset without storage if no fill value is
+        // defined, which is the case for datasets created by this library.
+        std::vector<T> current;
+        if (spaceStatus != H5D_SPACE_STATUS_NOT_ALLOCATED) {
+            current = m_dataset.read<T>(chunk, TransferMode::Independent);
+        }
+        for (size_t i = 0; i < target.data.size(); ++i) {
+            if (!target.written[i]) {
+                target.data[i] = current.empty() ? m_fillValue : current[i];
+            }
+        }
+    }
+    m_dataset.write<T>(target.data, chunk, TransferMode::Independent);
+
+    m_bufferedBytes -= target.data.size() * sizeof(T);
+    m_blocks.erase(it);
+}
@@ -0,0 +1,206 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <compare>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+#include "PLIHDF5/dataset.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Regular grid of chunks covering a dataset.
+ *
+ * The hyperslab of each chunk is computed from its index when it is accessed,
+ * so the memory consumption does not depend on the number of chunks. Chunks
+ * are numbered in row-major order, i.e. the last dimension changes fastest.
+ * Chunks at the upper border of the dataset are cut to the dataset
+ * dimensions.
+ */
+class ChunkGrid {
+  public:
+    /**
+     * @brief Random access iterator over the chunks of a grid.
+     *
+     * Dereferencing the iterator returns the hyperslab of the chunk by value.
+     */
+    class Iterator {
+      public:
+        using iterator_category = std::random_access_iterator_tag;
+        using iterator_concept = std::random_access_iterator_tag;
+        using value_type = Dataset::Hyperslab;
+        using difference_type = std::ptrdiff_t;
+        using reference = Dataset::Hyperslab;
+
+        Iterator() noexcept = default;
+        Iterator(const ChunkGrid *grid, size_t index) noexcept;
+
+        reference operator*() const;
+        reference operator[](difference_type offset) const;
+
+        Iterator &operator++() noexcept;
+        Iterator operator++(int) noexcept;
+        Iterator &operator--() noexcept;
+        Iterator operator--(int) noexcept;
+        Iterator &operator+=(difference_type offset) noexcept;
+        Iterator &operator-=(difference_type offset) noexcept;
+        Iterator operator+(difference_type offset) const noexcept;
+        Iterator operator-(difference_type offset) const noexcept;
+        difference_type operator-(const Iterator &other) const noexcept;
+        friend Iterator operator+(difference_type offset,
+                                  const Iterator &iterator) noexcept {
+            return iterator + offset;
+        }
+
+        bool operator==(const Iterator &other) const noexcept;
+        auto operator<=>(const Iterator &other) const noexcept {
+            return m_index <=> other.m_index;
+        }
+
+      private:
+        const ChunkGrid *m_grid = nullptr;
+        size_t m_index = 0;
+    };
+
+    using iterator = Iterator;
+    using const_iterator = Iterator;
+
+    /**
+     * @brief Construct an empty grid without chunks.
+     */
+    ChunkGrid() noexcept = default;
+    /**
+     * @brief Construct a new ChunkGrid object
+     * @param dims Dimensions of the dataset.
+     * @param chunkDims Dimensions of a chunk.
+     * @param origin Offset of the first chunk. The grid covers the area from
+     * the origin to the end of the dataset. Default = 0 in each dimension.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of dimensions differs or a chunk dimension is zero.
+     */
+    ChunkGrid(const std::vector<size_t> &dims,
+              const std::vector<size_t> &chunkDims,
+              const std::vector<size_t> &origin = {});
+
+    /**
+     * @brief Returns the number of chunks of the grid.
+     * @return size_t Number of chunks.
+     */
+    size_t size() const noexcept;
+    /**
+     * @brief Returns if the grid has no chunks.
+     * @return true Grid is empty.
+     * @return false Grid contains at least one chunk.
+     */
+    bool empty() const noexcept;
+    /**
+     * @brief Returns the number of dimensions of the grid.
+     * @return size_t Number of dimensions.
+     */
+    size_t ndims() const noexcept;
+    /**
+     * @brief Returns the dimensions of the dataset covered by the grid.
+     * @return const std::vector<size_t>& Dataset dimensions.
+     */
+    const std::vector<size_t> &dims() const noexcept;
+    /**
+     * @brief Returns the dimensions of a chunk.
+     * @return const std::vector<size_t>& Chunk dimensions.
+     */
+    const std::vector<size_t> &chunkDims() const noexcept;
+    /**
+     * @brief Returns the number of chunks in each dimension.
+     * @return const std::vector<size_t>& Number of chunks per dimension.
+     */
+    const std::vector<size_t> &gridDims() const noexcept;
+
+    /**
+     * @brief Returns the hyperslab of a chunk without bounds checking.
+     * @param index Index of the chunk.
+     * @return Dataset::Hyperslab Area of the dataset covered by the chunk.
+     */
+    Dataset::Hyperslab operator[](size_t index) const;
+    /**
+     * @brief Returns the hyperslab of a chunk.
+     * @param index Index of the chunk.
+     * @return Dataset::Hyperslab Area of the dataset covered by the chunk.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the index
+     * is out of range.
+     */
+    Dataset::Hyperslab at(size_t index) const;
+
+    /**
+     * @brief Returns the position of a chunk in the grid.
+     * @param index Index of the chunk.
+     * @return std::vector<size_t> Position of the chunk in units of chunks.
+     */
+    std::vector<size_t> chunkCoordinates(size_t index) const;
+    /**
+     * @brief Returns the index of the chunk at a position in the grid.
+     * @param chunkCoordinates Position of the chunk in units of chunks.
+     * @return size_t Index of the chunk.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * position is outside of the grid.
+     */
+    size_t chunkIndex(const std::vector<size_t> &chunkCoordinates) const;
+    /**
+     * @brief Returns the index of the chunk containing an element.
+     * @param coordinates Coordinates of the element in the dataset.
+     * @return size_t Index of the chunk.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * element is not covered by the grid.
+     */
+    size_t chunkIndexOf(const std::vector<size_t> &coordinates) const;
+
+    iterator begin() const noexcept;
+    iterator end() const noexcept;
+
+    /**
+     * @brief Returns the hyperslabs of all chunks.
+     * @return std::vector<Dataset::Hyperslab> Hyperslab of each chunk.
+     */
+    std::vector<Dataset::Hyperslab> toVector() const;
+
+  private:
+    std::vector<size_t> m_dims;
+    std::vector<size_t> m_chunkDims;
+    std::vector<size_t> m_origin;
+    std::vector<size_t> m_gridDims;
+    size_t m_size = 0;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/chunks.h"
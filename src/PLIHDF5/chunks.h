@@ -0,0 +1,205 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <future>
+#include <iterator>
+#include <optional>
+#include <vector>
+
+#include "PLIHDF5/chunkgrid.h"
+#include "PLIHDF5/dataset.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+template <typename T> class ChunkRange;
+
+/**
+ * @brief Chunk of a dataset returned by PLI::HDF5::ChunkRange.
+ * Contains the position of the chunk in the dataset and its data.
+ */
+template <typename T> struct Chunk {
+    /// Position of the chunk in the list of chunks of the range.
+    size_t index{0};
+    /// Area of the dataset covered by the chunk.
+    Dataset::Hyperslab hyperslab;
+    /// Data of the chunk in row-major order. Includes the halo if the range
+    /// was created with Dataset::chunksWithHalo.
+    std::vector<T> data;
+};
+
+/**
+ * @brief Input iterator over the chunks of a PLI::HDF5::ChunkRange.
+ *
+ * The iterator is single pass. The chunk returned by dereferencing the
+ * iterator is only valid until the iterator is incremented, because its
+ * buffer is reused for the following chunks.
+ */
+template <typename T> class ChunkIterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = Chunk<T>;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const Chunk<T> *;
+    using reference = const Chunk<T> &;
+
+    ChunkIterator(ChunkRange<T> *range, size_t position) noexcept;
+
+    reference operator*() const;
+    pointer operator->() const;
+    /**
+     * @brief Move to the next chunk.
+     * Waits until the next chunk is read and starts reading the chunk after.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If reading the
+     * chunk failed.
+     */
+    ChunkIterator &operator++();
+    void operator++(int);
+    bool operator==(const ChunkIterator &other) const noexcept;
+    bool operator!=(const ChunkIterator &other) const noexcept;
+
+  private:
+    ChunkRange<T> *m_range;
+    size_t m_position;
+};
+
+/**
+ * @brief Range reading a dataset chunk by chunk.
+ *
+ * Each chunk is read into a typed buffer. If prefetching is enabled, chunk N+1
+ * is read on a background thread while the caller processes chunk N. Only two
+ * buffers are used for the whole range, so the memory consumption does not
+ * depend on the size of the dataset.
+ *
+ * Prefetching is only used if the HDF5 library was built thread-safe, so the
+ * caller can use other HDF5 functions while a chunk is read in the
+ * background. When the file was opened with an MPI_Comm, MPI has to be
+ * initialized with MPI_THREAD_MULTIPLE as well. Otherwise, the chunks are
+ * read on the calling thread. Chunks are always read with
+ * TransferMode::Independent, so processes can iterate over different chunks.
+ */
+template <typename T> class ChunkRange {
+  public:
+    using iterator = ChunkIterator<T>;
+
+    /**
+     * @brief Construct a new ChunkRange object
+     * @param dataset Dataset to read from.
+     * @param chunks Areas of the dataset which will be read in this order.
+     * @param prefetch Read the next chunk on a background thread.
+     */
+    ChunkRange(const Dataset &dataset,
+               const std::vector<Dataset::Hyperslab> &chunks,
+               const bool prefetch = true);
+    /**
+     * @brief Construct a new ChunkRange object
+     * @param dataset Dataset to read from.
+     * @param grid Grid of chunks which will be read in the order of their
+     * index. The hyperslabs are computed when a chunk is read.
+     * @param prefetch Read the next chunk on a background thread.
+     */
+    ChunkRange(const Dataset &dataset, const ChunkGrid &grid,
+               const bool prefetch = true);
+    /**
+     * @brief Construct a new ChunkRange object reading each chunk with a
+     * border of neighbouring elements.
+     *
+     * See PLI::HDF5::Dataset::chunksWithHalo.
+     * @param dataset Dataset to read from.
+     * @param grid Grid of chunks without halo.
+     * @param halo Width of the border in each dimension.
+     * @param boundary Values of the border outside of the dataset.
+     * @param constant Value used with BoundaryMode::Constant.
+     * @param prefetch Read the next chunk on a background thread.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the halo
+     * does not match the dimensions of the grid.
+     */
+    ChunkRange(const Dataset &dataset, const ChunkGrid &grid,
+               const std::vector<size_t> &halo,
+               const BoundaryMode boundary = BoundaryMode::Clamp,
+               const T &constant = T(), const bool prefetch = true);
+    ChunkRange(const ChunkRange &) = delete;
+    ChunkRange(ChunkRange &&) = delete;
+    ChunkRange &operator=(const ChunkRange &) = delete;
+    ChunkRange &operator=(ChunkRange &&) = delete;
+    /**
+     * @brief Destroy the ChunkRange object
+     * Waits until a chunk which is read in the background is finished.
+     */
+    ~ChunkRange();
+
+    /**
+     * @brief Read the first chunk and return an iterator pointing to it.
+     * @return iterator Iterator pointing to the first chunk.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If reading the
+     * chunk failed.
+     */
+    iterator begin();
+    iterator end() noexcept;
+    /**
+     * @brief Returns the number of chunks in the range.
+     * @return size_t Number of chunks.
+     */
+    size_t size() const noexcept;
+    /**
+     * @brief Returns if the chunks are read on a background thread.
+     * @return true Prefetching is used.
+     * @return false Chunks are read when the iterator is incremented.
+     */
+    bool prefetching() const noexcept;
+
+  private:
+    friend class ChunkIterator<T>;
+
+    void advance();
+    Dataset::Hyperslab chunk(size_t index) const;
+    void readChunk(Chunk<T> &chunk, const Chunk<T> *previous = nullptr) const;
+    void startPrefetch(size_t index);
+    void waitForPrefetch();
+
+    Dataset m_dataset;
+    std::vector<Dataset::Hyperslab> m_chunks;
+    std::optional<ChunkGrid> m_grid;
+    std::vector<size_t> m_halo;
+    BoundaryMode m_boundary;
+    T m_constant;
+    bool m_prefetch;
+    size_t m_position;
+    Chunk<T> m_current;
+    Chunk<T> m_next;
+    std::future<void> m_pending;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/chunks.tpp"
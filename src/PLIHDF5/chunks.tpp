@@ -0,0 +1,269 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <functional>
+#include <numeric>
+#include <utility>
+
+#include "PLIHDF5/chunks.h"
+#include "PLIHDF5/exceptions.h"
+
+template <typename T>
+PLI::HDF5::ChunkRange<T>
+PLI::HDF5::Dataset::chunks(const std::vector<size_t> &chunkDims,
+                           const bool prefetch) const {
+    if (chunkDims.empty()) {
+        return PLI::HDF5::ChunkRange<T>(*this, this->chunkGrid(), prefetch);
+    }
+    return PLI::HDF5::ChunkRange<T>(*this, this->chunkGrid(chunkDims),
+                                    prefetch);
+}
+
+template <typename T>
+PLI::HDF5::ChunkRange<T> PLI::HDF5::Dataset::chunksWithHalo(
+    const std::vector<size_t> &halo, const BoundaryMode boundary,
+    const T &constant, const std::vector<size_t> &chunkDims,
+    const bool prefetch) const {
+    return PLI::HDF5::ChunkRange<T>(*this,
+                                    chunkDims.empty()
+                                        ? this->chunkGrid()
+                                        : this->chunkGrid(chunkDims),
+                                    halo, boundary, constant, prefetch);
+}
+
+/*
+ * PLI::HDF5::ChunkIterator
+ */
+template <typename T>
+PLI::HDF5::ChunkIterator<T>::ChunkIterator(ChunkRange<T> *range,
+                                           size_t position) noexcept
+    : m_range(range), m_position(position) {}
+
+template <typename T>
+typename PLI::HDF5::ChunkIterator<T>::reference
+PLI::HDF5::ChunkIterator<T>::operator*() const {
+    return m_range->m_current;
+}
+
+template <typename T>
+typename PLI::HDF5::ChunkIterator<T>::pointer
+PLI::HDF5::ChunkIterator<T>::operator->() const {
+    return &m_range->m_current;
+}
+
+template <typename T>
+PLI::HDF5::ChunkIterator<T> &PLI::HDF5::ChunkIterator<T>::operator++() {
+    m_range->advance();
+    m_position = m_range->m_position;
+    return *this;
+}
+
+template <typename T> void PLI::HDF5::ChunkIterator<T>::operator++(int) {
+    ++(*this);
+}
+
+template <typename T>
+bool PLI::HDF5::ChunkIterator<T>::operator==(
+    const ChunkIterator &other) const noexcept {
+    return m_range == other.m_range && m_position == other.m_position;
+}
+
+template <typename T>
+bool PLI::HDF5::ChunkIterator<T>::operator!=(
+    const ChunkIterator &other) const noexcept {
+    return !(*this == other);
+}
+
+/*
+ * PLI::HDF5::ChunkRange
+ */
+template <typename T>
+PLI::HDF5::ChunkRange<T>::ChunkRange(
+    const Dataset &dataset, const std::vector<Dataset::Hyperslab> &chunks,
+    const bool prefetch)
+    : m_dataset(dataset), m_chunks(chunks),
+      m_boundary(BoundaryMode::Clamp), m_constant(), m_prefetch(prefetch),
+      m_position(chunks.size()) {
+    // Reads on the background thread would race with HDF5 calls of the
+    // caller unless the library serializes them.
+    if (m_prefetch) {
+        hbool_t threadSafe = false;
+        checkHDF5Call(H5is_library_threadsafe(&threadSafe),
+                      "H5is_library_threadsafe");
+        m_prefetch = threadSafe;
+    }
+    // MPI-IO calls from the background thread are only allowed if MPI
+    // guarantees thread safety.
+    if (m_prefetch && m_dataset.communicator()) {
+        int provided;
+        MPI_Query_thread(&provided);
+        m_prefetch = provided == MPI_THREAD_MULTIPLE;
+    }
+}
+
+template <typename T>
+PLI::HDF5::ChunkRange<T>::ChunkRange(const Dataset &dataset,
+                                     const ChunkGrid &grid,
+                                     const bool prefetch)
+    : ChunkRange(dataset, std::vector<Dataset::Hyperslab>(), prefetch) {
+    m_grid = grid;
+    m_position = grid.size();
+}
+
+template <typename T>
+PLI::HDF5::ChunkRange<T>::ChunkRange(const Dataset &dataset,
+                                     const ChunkGrid &grid,
+                                     const std::vector<size_t> &halo,
+                                     const BoundaryMode boundary,
+                                     const T &constant, const bool prefetch)
+    : ChunkRange(dataset, grid, prefetch) {
+    if (halo.size() != grid.ndims()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Halo must have the same size as the chunk dimensions.");
+    }
+    m_halo = halo;
+    m_boundary = boundary;
+    m_constant = constant;
+}
+
+template <typename T> PLI::HDF5::ChunkRange<T>::~ChunkRange() {
+    if (m_pending.valid()) {
+        m_pending.wait();
+    }
+}
+
+template <typename T>
+typename PLI::HDF5::ChunkRange<T>::iterator PLI::HDF5::ChunkRange<T>::begin() {
+    waitForPrefetch();
+    m_position = 0;
+    if (size() == 0) {
+        return end();
+    }
+    m_current.index = 0;
+    m_current.hyperslab = chunk(0);
+    readChunk(m_current);
+    startPrefetch(1);
+    return iterator(this, m_position);
+}
+
+template <typename T>
+typename PLI::HDF5::ChunkRange<T>::iterator
+PLI::HDF5::ChunkRange<T>::end() noexcept {
+    return iterator(this, size());
+}
+
+template <typename T> size_t PLI::HDF5::ChunkRange<T>::size() const noexcept {
+    return m_grid ? m_grid->size() : m_chunks.size();
+}
+
+template <typename T>
+bool PLI::HDF5::ChunkRange<T>::prefetching() const noexcept {
+    return m_prefetch;
+}
+
+template <typename T> void PLI::HDF5::ChunkRange<T>::advance() {
+    if (m_position >= size()) {
+        return;
+    }
+    ++m_position;
+    if (m_position >= size()) {
+        waitForPrefetch();
+        return;
+    }
+    if (m_pending.valid()) {
+        // Rethrows exceptions of the background thread.
+        m_pending.get();
+        std::swap(m_current, m_next);
+    } else if (!m_halo.empty()) {
+        // Keep the previous chunk to reuse the overlapping part of its halo.
+        m_next.index = m_position;
+        m_next.hyperslab = chunk(m_position);
+        readChunk(m_next, &m_current);
+        std::swap(m_current, m_next);
+    } else {
+        m_current.index = m_position;
+        m_current.hyperslab = chunk(m_position);
+        readChunk(m_current);
+    }
+    startPrefetch(m_position + 1);
+}
+
+template <typename T>
+PLI::HDF5::Dataset::Hyperslab
+PLI::HDF5::ChunkRange<T>::chunk(size_t index) const {
+    return m_grid ? (*m_grid)[index] : m_chunks[index];
+}
+
+template <typename T>
+void PLI::HDF5::ChunkRange<T>::readChunk(Chunk<T> &chunk,
+                                         const Chunk<T> *previous) const {
+    const auto &count = chunk.hyperslab.count();
+    if (m_halo.empty()) {
+        chunk.data.resize(std::accumulate(count.begin(), count.end(),
+                                          size_t(1),
+                                          std::multiplies<size_t>()));
+        // Processes may read different numbers of chunks, possibly on the
+        // prefetch thread, so collective reads would not match.
+        m_dataset.read<T>(chunk.data.data(), chunk.hyperslab,
+                          TransferMode::Independent);
+        return;
+    }
+
+    size_t numElements = 1;
+    for (size_t i = 0; i < m_halo.size(); ++i) {
+        numElements *= count[i] + 2 * m_halo[i];
+    }
+    chunk.data.resize(numElements);
+    if (m_boundary == BoundaryMode::Constant) {
+        std::fill(chunk.data.begin(), chunk.data.end(), m_constant);
+    }
+    m_dataset.readHaloRegion(
+        static_cast<void *>(chunk.data.data()), chunk.hyperslab, m_halo,
+        m_boundary, PLI::HDF5::Type::createType<T>(),
+        TransferMode::Independent,
+        previous ? static_cast<const void *>(previous->data.data()) : nullptr,
+        previous ? &previous->hyperslab : nullptr);
+}
+
+template <typename T>
+void PLI::HDF5::ChunkRange<T>::startPrefetch(size_t index) {
+    if (!m_prefetch || index >= size()) {
+        return;
+    }
+    m_next.index = index;
+    m_next.hyperslab = chunk(index);
+    m_pending = std::async(std::launch::async,
+                           [this]() { readChunk(m_next, &m_current); });
+}
+
+template <typename T> void PLI::HDF5::ChunkRange<T>::waitForPrefetch() {
+    if (m_pending.valid()) {
+        m_pending.get();
+    }
+}
@@ -0,0 +1,198 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <mpi.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "PLIHDF5/chunkgrid.h"
+#include "PLIHDF5/chunks.h"
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/options.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Distributes the chunks of a dataset to the processes of an MPI job.
+ *
+ * The static schedules assign each process a contiguous part of the chunks,
+ * either in row-major order or along a Hilbert curve, which keeps the chunks
+ * of a process close to each other in the image and in the file. Both are
+ * balanced by the stored size of the chunks if possible. With work stealing,
+ * processes take the next chunk from a counter in an MPI window instead, so
+ * fast processes continue with the chunks left over by slow ones.
+ *
+ * Without an MPI_Comm, all chunks are processed by the calling process. The
+ * constructor and destructor are collective if the dataset was opened with an
+ * MPI_Comm.
+ */
+class ChunkScheduler {
+  public:
+    /**
+     * @brief Construct a new ChunkScheduler object for the chunks of the
+     * dataset.
+     * @param dataset Dataset whose chunks will be distributed.
+     * @param options Distribution of the chunks.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the
+     * dataset is invalid.
+     */
+    explicit ChunkScheduler(const Dataset &dataset,
+                            const ChunkScheduleOptions &options = {});
+    /**
+     * @brief Construct a new ChunkScheduler object for the given grid.
+     *
+     * Stored sizes and allocation of the chunks are only known if the grid
+     * matches the chunks of the dataset. Otherwise, all chunks are weighted
+     * equally and none is skipped.
+     * @param dataset Dataset whose chunks will be distributed.
+     * @param grid Chunks to distribute.
+     * @param options Distribution of the chunks.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the
+     * dataset is invalid.
+     */
+    ChunkScheduler(const Dataset &dataset, const ChunkGrid &grid,
+                   const ChunkScheduleOptions &options = {});
+    ChunkScheduler(const ChunkScheduler &) = delete;
+    ChunkScheduler(ChunkScheduler &&) = delete;
+    ChunkScheduler &operator=(const ChunkScheduler &) = delete;
+    ChunkScheduler &operator=(ChunkScheduler &&) = delete;
+    /**
+     * @brief Destroy the ChunkScheduler object
+     * Frees the MPI window of the work stealing counter (collective).
+     */
+    ~ChunkScheduler();
+
+    /**
+     * @brief Returns the index of the next chunk of this process in the grid.
+     * @return std::optional<size_t> Index of the chunk or std::nullopt if all
+     * chunks are processed.
+     */
+    std::optional<size_t> next();
+
+    /**
+     * @brief Returns the chunk indices assigned to this process by a static
+     * schedule in processing order. Empty for ChunkSchedule::WorkStealing,
+     * where the chunks are assigned while processing.
+     * @return const std::vector<size_t>& Indices of the chunks in the grid.
+     */
+    const std::vector<size_t> &assignedChunks() const noexcept;
+
+    /**
+     * @brief Returns the number of chunks processed by all processes together,
+     * i.e. without skipped chunks.
+     * @return size_t Number of chunks.
+     */
+    size_t size() const noexcept;
+
+    /**
+     * @brief Returns the grid of the chunks.
+     * @return const ChunkGrid& Chunk grid.
+     */
+    const ChunkGrid &grid() const noexcept;
+
+    /**
+     * @brief Returns the distribution of the chunks.
+     * @return ChunkSchedule Schedule.
+     */
+    ChunkSchedule schedule() const noexcept;
+
+    /**
+     * @brief Position of a point on a Hilbert curve.
+     *
+     * The curve fills a square of side length order, which has to be a power
+     * of two.
+     * @param order Side length of the square.
+     * @param x First coordinate.
+     * @param y Second coordinate.
+     * @return uint64_t Distance from the start of the curve.
+     */
+    static uint64_t hilbertIndex(uint64_t order, uint64_t x, uint64_t y);
+
+  private:
+    std::vector<uint64_t> chunkWeights(const Dataset &dataset) const;
+    std::vector<size_t> chunkOrder(const std::vector<uint64_t> &weights) const;
+    void assignChunks(const std::vector<size_t> &order,
+                      const std::vector<uint64_t> &weights);
+    void createCounter();
+
+    ChunkGrid m_grid;
+    ChunkScheduleOptions m_options;
+    std::optional<MPI_Comm> m_communicator;
+    int m_rank;
+    int m_size;
+    /// Chunks assigned to this process by a static schedule.
+    std::vector<size_t> m_chunks;
+    /// All chunks in processing order when work stealing.
+    std::vector<size_t> m_order;
+    size_t m_total;
+    size_t m_position;
+    MPI_Win m_window;
+    uint64_t *m_counter;
+};
+
+/**
+ * @brief Reads and processes the chunks assigned to this process.
+ *
+ * The chunks are read independently (TransferMode::Independent), because the
+ * processes may handle different numbers of chunks. Must be called by all
+ * processes if the dataset was opened with an MPI_Comm.
+ * @tparam T Type of the elements.
+ * @param dataset Dataset to read from.
+ * @param scheduler Scheduler distributing the chunks of the dataset.
+ * @param function Called with each chunk as const PLI::HDF5::Chunk<T>&. The
+ * index of the chunk is its index in the grid of the scheduler.
+ */
+template <typename T, typename Function>
+void forEachChunk(const Dataset &dataset, ChunkScheduler &scheduler,
+                  Function &&function);
+
+/**
+ * @brief Reads and processes the chunks of a dataset balanced over the
+ * processes of its MPI_Comm.
+ *
+ * See forEachChunk(const Dataset&, ChunkScheduler&, Function&&).
+ * @tparam T Type of the elements.
+ * @param dataset Dataset to read from.
+ * @param function Called with each chunk as const PLI::HDF5::Chunk<T>&.
+ * @param options Distribution of the chunks.
+ */
+template <typename T, typename Function>
+void forEachChunk(const Dataset &dataset, Function &&function,
+                  const ChunkScheduleOptions &options = {});
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/chunkscheduler.tpp"
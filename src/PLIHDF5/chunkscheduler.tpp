@@ -0,0 +1,58 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <functional>
+#include <numeric>
+#include <optional>
+#include <utility>
+
+#include "PLIHDF5/chunkscheduler.h"
+
+template <typename T, typename Function>
+void PLI::HDF5::forEachChunk(const Dataset &dataset, ChunkScheduler &scheduler,
+                             Function &&function) {
+    Chunk<T> chunk;
+    while (const std::optional<size_t> index = scheduler.next()) {
+        chunk.index = index.value();
+        chunk.hyperslab = scheduler.grid()[chunk.index];
+        const auto &count = chunk.hyperslab.count();
+        chunk.data.resize(std::accumulate(count.begin(), count.end(),
+                                          size_t(1),
+                                          std::multiplies<size_t>()));
+        dataset.read<T>(chunk.data.data(), chunk.hyperslab,
+                        TransferMode::Independent);
+        function(std::as_const(chunk));
+    }
+}
+
+template <typename T, typename Function>
+void PLI::HDF5::forEachChunk(const Dataset &dataset, Function &&function,
+                             const ChunkScheduleOptions &options) {
+    ChunkScheduler scheduler(dataset, options);
+    PLI::HDF5::forEachChunk<T>(dataset, scheduler,
+                               std::forward<Function>(function));
+}
@@ -28,12 +28,24 @@
 #include <hdf5.h>
 
 #include <algorithm>
+#include <array>
+#include <cstdint>
+#include <functional>
+#include <initializer_list>
 #include <iterator>
+#include <memory>
+#include <mutex>
+#include <optional>
 #include <ostream>
+#include <span>
 #include <string>
 #include <vector>
 
+#include "PLIHDF5/allocator.h"
+#include "PLIHDF5/asyncio.h"
+#include "PLIHDF5/mappedview.h"
 #include "PLIHDF5/object.h"
+#include "PLIHDF5/smallvector.h"
 #include "PLIHDF5/type.h"
 
 /**
@@ -44,6 +56,9 @@ namespace PLI {
  * @brief The HDF5 namespace
  */
 namespace HDF5 {
+template <typename T> class ChunkRange;
+class ChunkGrid;
+class DatasetGroupIO;
 
 /**
  * @brief HDF5 Dataset wrapper class.
@@ -56,6 +71,16 @@ class Dataset : public Object {
     class Slices;
     class Hyperslab;
 
+    /**
+     * @brief Chunk as stored in the file, i.e. after the filter pipeline.
+     */
+    struct RawChunk {
+        /// Stored bytes of the chunk.
+        std::vector<uint8_t> data;
+        /// Bit i is set if filter i of the pipeline was skipped for the chunk.
+        uint32_t filterMask = 0;
+    };
+
     /**
      * @brief Construct a new Dataset object
      *
@@ -91,12 +116,14 @@ class Dataset : public Object {
      * dataset does not exist, an exception is thrown.
      * @param parentPtr File or group pointer.
      * @param datasetName Name of the dataset to open.
+     * @param options Chunk cache options of the dataset.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
      * or dataset pointer is invalid.
      * @throws PLI::HDF5::Exceptions::DatasetNotFoundException If the dataset
      * does not exist.
      */
-    void open(const Folder &parentPtr, const std::string &datasetName);
+    void open(const Folder &parentPtr, const std::string &datasetName,
+              const DatasetAccessOptions &options = {});
     /**
      * @brief Create a new dataset with the given name.
      *
@@ -124,6 +151,26 @@ class Dataset : public Object {
                 const std::vector<size_t> &dims,
                 const std::vector<size_t> &chunkDims = {});
 
+    /**
+     * @brief Create a new dataset with the given name.
+     *
+     * Same as the method above for braced chunk dimensions, e.g. {} or
+     * {64, 64}. This overload keeps such calls unambiguous with the overload
+     * taking PLI::HDF5::DatasetCreateOptions.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param parentPtr Raw HDF5 pointer to a file or group.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param chunkDims Chunking dimensions of the dataset. If empty, the
+     * chunking is disabled.
+     */
+    template <typename T>
+    void create(const Folder &parentPtr, const std::string &datasetName,
+                const std::vector<size_t> &dims,
+                std::initializer_list<size_t> chunkDims);
+
     /**
      * @brief Create a new dataset with the given name.
      *
@@ -151,6 +198,118 @@ class Dataset : public Object {
         const std::vector<size_t> &dims,
         const std::vector<size_t> &chunkDims = {},
         const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
+
+    /**
+     * @brief Create a new dataset with the given name.
+     *
+     * Same as the method above for braced chunk dimensions, e.g. {} or
+     * {64, 64}. This overload keeps such calls unambiguous with the overload
+     * taking PLI::HDF5::DatasetCreateOptions.
+     * @param parentPtr Raw HDF5 pointer to a file or group.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param chunkDims Chunking dimensions of the dataset. If empty, the
+     * chunking is disabled.
+     * @param dataType Datatype of the dataset. Default = float.
+     */
+    void create(
+        const Folder &parentPtr, const std::string &datasetName,
+        const std::vector<size_t> &dims,
+        std::initializer_list<size_t> chunkDims,
+        const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
+
+    /**
+     * @brief Create a new dataset with the given name and options.
+     *
+     * This method tries to create a new dataset with the given name. If the
+     * dataset already exists, an exception is thrown.
+     * Besides the chunk dimensions, the options configure the shuffle,
+     * compression and checksum filters of the dataset.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param parentPtr Raw HDF5 pointer to a file or group.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param options Chunking and filter options of the dataset.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
+     * or dataset pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::DatasetExistsException If the dataset
+     * already exists.
+     * @throws PLI::HDF5::Exceptions::FilterNotAvailableException If a
+     * requested filter is not available.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be created.
+     */
+    template <typename T>
+    void create(const Folder &parentPtr, const std::string &datasetName,
+                const std::vector<size_t> &dims,
+                const DatasetCreateOptions &options);
+
+    /**
+     * @brief Create a new dataset with the given name and options.
+     *
+     * This method tries to create a new dataset with the given name. If the
+     * dataset already exists, an exception is thrown.
+     * Besides the chunk dimensions, the options configure the shuffle,
+     * compression and checksum filters of the dataset.
+     * @param parentPtr Raw HDF5 pointer to a file or group.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param options Chunking and filter options of the dataset.
+     * @param dataType Datatype of the dataset. Default = float.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
+     * or dataset pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::DatasetExistsException If the dataset
+     * already exists.
+     * @throws PLI::HDF5::Exceptions::FilterNotAvailableException If a
+     * requested filter is not available.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be created.
+     */
+    void create(
+        const Folder &parentPtr, const std::string &datasetName,
+        const std::vector<size_t> &dims, const DatasetCreateOptions &options,
+        const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
+
+    /**
+     * @brief Choose chunk dimensions for a dataset.
+     *
+     * The chunk dimensions approach the target size of the policy and follow
+     * its access profile. Each chunk dimension is at least one and at most
+     * the dataset dimension. When using MPI, the first dimension is split so
+     * that every process can work on its own row of chunks.
+     * @param dims Dimensions of the dataset.
+     * @param dataType Datatype of the dataset.
+     * @param policy Target size and access profile of the chunks.
+     * @param numProcesses Number of processes working on the dataset.
+     * @return std::vector<size_t> Chunk dimensions.
+     */
+    static std::vector<size_t> autoChunkDims(const std::vector<size_t> &dims,
+                                             const PLI::HDF5::Type &dataType,
+                                             const ChunkPolicy &policy,
+                                             const int numProcesses = 1);
+
+    /**
+     * @brief Check if a compression filter can be used.
+     *
+     * Plugin filters are searched in the paths of HDF5_PLUGIN_PATH.
+     * @param compression Compression filter.
+     * @return true The filter is available and can encode data.
+     * @return false The filter is not available.
+     */
+    static bool filterAvailable(const Compression compression);
+
+    /**
+     * @brief Check if a shuffle filter can be used.
+     *
+     * Plugin filters are searched in the paths of HDF5_PLUGIN_PATH.
+     * @param shuffle Shuffle filter.
+     * @return true The filter is available and can encode data.
+     * @return false The filter is not available.
+     */
+    static bool filterAvailable(const Shuffle shuffle);
+
     /**
      * @brief Check if the dataset exists.
      *
@@ -171,6 +330,37 @@ class Dataset : public Object {
      */
     bool isChunked() const;
 
+    /**
+     * @brief Returns the names of the filters applied to the dataset in the
+     * order of the filter pipeline.
+     * @return std::vector<std::string> Names of the filters. Empty if no filter
+     * is used.
+     */
+    std::vector<std::string> filters() const;
+
+    /**
+     * @brief Returns the options needed to create a dataset with the same
+     * layout and filter pipeline as this dataset.
+     *
+     * Chunk dimensions, maximum dimensions, shuffle, compression with its
+     * level and Fletcher32 checksums are taken from the dataset. Filters which
+     * cannot be expressed by PLI::HDF5::DatasetCreateOptions are skipped.
+     * @return DatasetCreateOptions Options of the dataset. The chunk cache is
+     * not set.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * is not valid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the creation
+     * property list could not be queried.
+     */
+    DatasetCreateOptions createOptions() const;
+
+    /**
+     * @brief Returns the chunk cache settings of the opened dataset.
+     * @return DatasetAccessOptions Cache size, number of slots and preemption
+     * policy. The access pattern is not set.
+     */
+    DatasetAccessOptions accessOptions() const;
+
     /**
      * @brief Returns the size of the chunks chosen when creating the dataset.
      * If the dataset is not chunked, an exception is thrown.
@@ -186,13 +376,43 @@ class Dataset : public Object {
      * @tparam T Supported data types are: bool, char, unsigned char, short,
      * unsigned short, int, unsigned int, long, unsigned long, long long,
      * unsigned long long, float, double, long double.
-     * @return std::vector<T> 1D vector with the data.
+     * @tparam Allocator Allocator of the returned vector. Use
+     * PLI::HDF5::DefaultInitAllocator to skip zeroing the vector before
+     * reading.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<T, Allocator> 1D vector with the data.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be read.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
-    template <typename T> std::vector<T> readFullDataset() const;
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator> readFullDataset(
+        const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read the whole dataset into a caller-owned buffer.
+     *
+     * This method reads the whole dataset into the given buffer. Here, each
+     * MPI process will read the whole dataset.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Buffer with exactly as many elements as the dataset.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the size of
+     * the buffer does not match the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    template <typename T>
+    void readFullDataset(
+        std::span<T> data,
+        const std::optional<TransferMode> transferMode = {}) const;
 
     /**
      * @brief Read a sub-dataset.
@@ -207,19 +427,56 @@ class Dataset : public Object {
      * @tparam T Supported data types are: bool, char, unsigned char, short,
      * unsigned short, int, unsigned int, long, unsigned long, long long,
      * unsigned long long, float, double, long double.
+     * @tparam Allocator Allocator of the returned vector. Use
+     * PLI::HDF5::DefaultInitAllocator to skip zeroing the vector before
+     * reading.
      * @param offset Offset in each dimension.
      * @param count Number of elements to read in each dimension.
      * @param stride Stride between each element
-     * @return std::vector<T> 1D vector with the data.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<T, Allocator> 1D vector with the data.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator>
+    read(const std::vector<size_t> &offset, const std::vector<size_t> &count,
+         const std::vector<size_t> &stride = {},
+         const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a sub-dataset into a caller-owned buffer.
+     *
+     * With this method, only a sub-area of the dataset can be read. The
+     * dimensions of the sub-dataset are given by the offset in each dimension
+     * and the count. The buffer has to hold exactly the number of selected
+     * elements. The conversion is handled by the HDF5 library. This method
+     * does not check if the selected area is valid. If it is out of bounds, an
+     * exception is thrown through an erronous HDF5 call.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Buffer receiving the data.
+     * @param offset Offset in each dimension.
+     * @param count Number of elements to read in each dimension.
+     * @param stride Stride between each element
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the size of
+     * the buffer does not match the selection.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be read.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
     template <typename T>
-    std::vector<T> read(const std::vector<size_t> &offset,
-                        const std::vector<size_t> &count,
-                        const std::vector<size_t> &stride = {}) const;
+    void read(std::span<T> data, const std::vector<size_t> &offset,
+              const std::vector<size_t> &count,
+              const std::vector<size_t> &stride = {},
+              const std::optional<TransferMode> transferMode = {}) const;
 
     /**
      * @brief Read a sub-dataset.
@@ -238,6 +495,8 @@ class Dataset : public Object {
      * @param offset Offset in each dimension.
      * @param count Number of elements to read in each dimension.
      * @param stride Stride between each element
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be read.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
@@ -246,7 +505,8 @@ class Dataset : public Object {
     template <typename T>
     void read(T *const data, const std::vector<size_t> &offset,
               const std::vector<size_t> &count,
-              const std::vector<size_t> &stride = {}) const;
+              const std::vector<size_t> &stride = {},
+              const std::optional<TransferMode> transferMode = {}) const;
 
     /**
      * @brief Read a sub-dataset.
@@ -261,14 +521,48 @@ class Dataset : public Object {
      * @tparam T Supported data types are: bool, char, unsigned char, short,
      * unsigned short, int, unsigned int, long, unsigned long, long long,
      * unsigned long long, float, double, long double.
+     * @tparam Allocator Allocator of the returned vector. Use
+     * PLI::HDF5::DefaultInitAllocator to skip zeroing the vector before
+     * reading.
      * @param hyperslab hyperslab of data dimension.
-     * @return std::vector<T> 1D vector with the data.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<T, Allocator> 1D vector with the data.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be read.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
-    template <typename T> std::vector<T> read(const Hyperslab &hyperslab) const;
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator>
+    read(const Hyperslab &hyperslab,
+         const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a sub-dataset into a caller-owned buffer.
+     *
+     * With this method, only a sub-area of the dataset can be read. The
+     * buffer has to hold exactly the number of selected elements. The
+     * conversion is handled by the HDF5 library. This method does not check if
+     * the selected area is valid. If it is out of bounds, an exception is
+     * thrown through an erronous HDF5 call.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Buffer receiving the data.
+     * @param hyperslab hyperslab of data dimension.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the size of
+     * the buffer does not match the selection.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    template <typename T>
+    void read(std::span<T> data, const Hyperslab &hyperslab,
+              const std::optional<TransferMode> transferMode = {}) const;
 
     /**
      * @brief Read a sub-dataset.
@@ -285,13 +579,275 @@ class Dataset : public Object {
      * unsigned long long, float, double, long double.
      * @param data data pointer.
      * @param hyperslab hyperslab of data dimension.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be read.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
     template <typename T>
-    void read(T *const data, const Hyperslab &hyperslab) const;
+    void read(T *const data, const Hyperslab &hyperslab,
+              const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a sub-dataset into a pointer.
+     *
+     * With this method, a selected area of the dataset can be read. The data
+     * is converted by the HDF5 library to the given datatype. The pointer
+     * needs to have enough memory allocated to hold all elements. This method
+     * does not check if the selected area is valid. If it is out of bounds, an
+     * exception is thrown through an erronous HDF5 call.
+     * @param data data pointer.
+     * @param offset Offset in each dimension.
+     * @param count Number of elements to read in each dimension.
+     * @param stride Stride between each element
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    void read(void *const data, const std::vector<size_t> &offset,
+              const std::vector<size_t> &count,
+              const std::vector<size_t> &stride, const PLI::HDF5::Type &type,
+              const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a sub-dataset into a pointer.
+     *
+     * With this method, a selected area of the dataset can be read. The data
+     * is converted by the HDF5 library to the given datatype. The pointer
+     * needs to have enough memory allocated to hold all elements. This method
+     * does not check if the selected area is valid. If it is out of bounds, an
+     * exception is thrown through an erronous HDF5 call.
+     * @param data data pointer.
+     * @param hyperslab hyperslab of data dimension.
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    void read(void *const data, const Hyperslab &hyperslab,
+              const PLI::HDF5::Type &type,
+              const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read many hyperslabs with few HDF5 calls.
+     *
+     * The hyperslabs are combined into one file selection and read with a
+     * single H5Dread into a staging buffer, from which each hyperslab is
+     * copied to its own vector. Each chunk is therefore read and decompressed
+     * once, even if it is touched by many hyperslabs. Hyperslabs may overlap.
+     * Large requests are split into batches of neighbouring chunks. With
+     * collective MPI-IO, all processes have to call this method, but they
+     * may pass different hyperslabs.
+     * @tparam T Type of the elements.
+     * @tparam Allocator Allocator of the returned vectors.
+     * @param hyperslabs Areas to read.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<std::vector<T, Allocator>> One vector per
+     * hyperslab, in the order of the hyperslabs.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If a
+     * hyperslab does not match the dimensions of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<std::vector<T, Allocator>>
+    readMany(std::span<const Hyperslab> hyperslabs,
+             const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read many hyperslabs into caller-owned buffers.
+     *
+     * See readMany(std::span<const Hyperslab>, std::optional<TransferMode>).
+     * @tparam T Type of the elements.
+     * @param hyperslabs Areas to read.
+     * @param outputs One buffer per hyperslab. Each buffer has to hold exactly
+     * the number of elements of its hyperslab.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * or the size of the buffers doesn't match the hyperslabs.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T>
+    void readMany(std::span<const Hyperslab> hyperslabs,
+                  std::span<const std::span<T>> outputs,
+                  const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read many hyperslabs into pointers.
+     *
+     * See readMany(std::span<const Hyperslab>, std::optional<TransferMode>).
+     * Each pointer needs to have enough memory allocated to hold all elements
+     * of its hyperslab.
+     * @param hyperslabs Areas to read.
+     * @param outputs One pointer per hyperslab.
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of pointers doesn't match the hyperslabs or a hyperslab does not match
+     * the dimensions of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    void readMany(std::span<const Hyperslab> hyperslabs,
+                  std::span<void *const> outputs, const PLI::HDF5::Type &type,
+                  const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read single elements at arbitrary coordinates.
+     *
+     * All points are read with one point selection. The points are sorted
+     * into chunk order internally and duplicates are read only once, so the
+     * cost depends on the number of chunks touched rather than on the number
+     * of points. The result is returned in the order of the coordinates.
+     * @tparam T Type of the elements.
+     * @tparam Allocator Allocator of the returned vector.
+     * @param coordinates Coordinates of the points. The coordinates of one
+     * point are stored consecutively, i.e. {x0, y0, z0, x1, y1, z1, ...} for a
+     * three dimensional dataset.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<T, Allocator> One element per point.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of coordinates is not a multiple of the number of dimensions or a point
+     * is outside of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator>
+    readPoints(std::span<const size_t> coordinates,
+               const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read single elements at arbitrary coordinates into a buffer.
+     *
+     * See readPoints(std::span<const size_t>, std::optional<TransferMode>).
+     * @tparam T Type of the elements.
+     * @param data Buffer holding exactly one element per point.
+     * @param coordinates Coordinates of the points, stored consecutively.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the buffer
+     * size doesn't match the number of points.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T>
+    void readPoints(std::span<T> data, std::span<const size_t> coordinates,
+                    const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read single elements at arbitrary coordinates into a pointer.
+     *
+     * See readPoints(std::span<const size_t>, std::optional<TransferMode>).
+     * The pointer needs to have enough memory allocated to hold one element
+     * per point.
+     * @param data data pointer.
+     * @param coordinates Coordinates of the points, stored consecutively.
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of coordinates is not a multiple of the number of dimensions or a point
+     * is outside of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    void readPoints(void *const data, std::span<const size_t> coordinates,
+                    const PLI::HDF5::Type &type,
+                    const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a tile together with a border of neighbouring elements.
+     *
+     * The tile is extended by halo elements on both sides of each dimension.
+     * The part of the extended area inside the dataset is read with a single
+     * call directly into the returned buffer. The part outside of the dataset
+     * is filled afterwards according to the boundary mode.
+     * @tparam T Type of the elements.
+     * @tparam Allocator Allocator of the returned vector.
+     * @param tile Area of the dataset without halo. The stride has to be 1.
+     * @param halo Width of the border in each dimension, e.g. {8, 8, 0} for
+     * an image with channels in the last dimension.
+     * @param boundary Values of the border outside of the dataset.
+     * @param constant Value used with BoundaryMode::Constant.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return std::vector<T, Allocator> Data of the extended tile in
+     * row-major order with dimensions count + 2 * halo.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If tile or
+     * halo do not match the dimensions of the dataset, the tile is not inside
+     * the dataset or has a stride.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<T, Allocator>
+    readWithHalo(const Hyperslab &tile, const std::vector<size_t> &halo,
+                 const BoundaryMode boundary = BoundaryMode::Clamp,
+                 const T &constant = T(),
+                 const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read a tile together with a border of neighbouring elements into
+     * a caller-owned buffer.
+     *
+     * See readWithHalo(const Hyperslab&, const std::vector<size_t>&,
+     * BoundaryMode, const T&, std::optional<TransferMode>).
+     * @tparam T Type of the elements.
+     * @param data Buffer holding exactly the elements of the extended tile.
+     * @param tile Area of the dataset without halo. The stride has to be 1.
+     * @param halo Width of the border in each dimension.
+     * @param boundary Values of the border outside of the dataset.
+     * @param constant Value used with BoundaryMode::Constant.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the buffer
+     * size doesn't match the extended tile, see above.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T>
+    void
+    readWithHalo(std::span<T> data, const Hyperslab &tile,
+                 const std::vector<size_t> &halo,
+                 const BoundaryMode boundary = BoundaryMode::Clamp,
+                 const T &constant = T(),
+                 const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Map the complete dataset read-only into memory.
+     *
+     * Contiguous datasets of non-MPI files, which are stored with exactly the
+     * datatype T, are memory-mapped. Elements are then read from the page
+     * cache without a copy or an allocation. All other datasets, e.g. chunked
+     * or compressed ones, are read with HDF5 into memory owned by the view.
+     * MappedView::isMapped tells which path was taken.
+     * The file is flushed before mapping. Later writes to the dataset are not
+     * guaranteed to be visible in the view.
+     * @tparam T Type of the elements.
+     * @param advice Expected access pattern of the mapping.
+     * @return PLI::HDF5::MappedView<T> View of all elements of the dataset.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the
+     * dataset is not valid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be read.
+     */
+    template <typename T>
+    MappedView<T> mapReadOnly(const MapAdvice advice = MapAdvice::Random) const;
 
     /**
      * @brief Write a sub-dataset.
@@ -310,6 +866,8 @@ class Dataset : public Object {
      * @param offset Offset in each dimension.
      * @param dims Number of elements to write in each dimension.
      * @param stride Stride between each element
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
@@ -318,7 +876,8 @@ class Dataset : public Object {
     template <typename T>
     void write(const std::vector<T> &data, const std::vector<size_t> &offset,
                const std::vector<size_t> &dims,
-               const std::vector<size_t> &stride = {});
+               const std::vector<size_t> &stride = {},
+               const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Write a sub-dataset.
@@ -337,6 +896,10 @@ class Dataset : public Object {
      * @param offset Offset in each dimension.
      * @param dims Number of elements to write in each dimension.
      * @param stride Stride between each element
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If offset,
+     * dims and stride have different sizes.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
@@ -345,7 +908,8 @@ class Dataset : public Object {
     template <typename T>
     void write(const void *data, const std::vector<size_t> &offset,
                const std::vector<size_t> &dims,
-               const std::vector<size_t> &stride = {});
+               const std::vector<size_t> &stride = {},
+               const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Write a sub-dataset.
@@ -362,6 +926,10 @@ class Dataset : public Object {
      * @param dims Number of elements to write in each dimension.
      * @param stride Stride between each element
      * @param type Datatype of the data.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If offset,
+     * dims and stride have different sizes.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
@@ -369,7 +937,8 @@ class Dataset : public Object {
      */
     void write(const void *data, const std::vector<size_t> &offset,
                const std::vector<size_t> &dims,
-               const std::vector<size_t> &stride, const PLI::HDF5::Type &type);
+               const std::vector<size_t> &stride, const PLI::HDF5::Type &type,
+               const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Write a sub-dataset.
@@ -386,13 +955,16 @@ class Dataset : public Object {
      * unsigned long long, float, double, long double.
      * @param data Data to write.
      * @param hyperslab hyperslab of writing dimension
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
     template <typename T>
-    void write(const std::vector<T> &data, const Hyperslab &hyperslab);
+    void write(const std::vector<T> &data, const Hyperslab &hyperslab,
+               const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Write a sub-dataset.
@@ -409,13 +981,16 @@ class Dataset : public Object {
      * unsigned long long, float, double, long double.
      * @param data Data to write.
      * @param hyperslab hyperslab of writing dimension
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
     template <typename T>
-    void write(const void *data, const Hyperslab &hyperslab);
+    void write(const void *data, const Hyperslab &hyperslab,
+               const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Write a sub-dataset.
@@ -430,18 +1005,72 @@ class Dataset : public Object {
      * @param data Data to write.
      * @param hyperslab hyperslab of writing dimension
      * @param type Datatype of the data.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
      * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
      * not be written.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * pointer is invalid.
      */
     void write(const void *data, const Hyperslab &hyperslab,
-               const PLI::HDF5::Type &type);
+               const PLI::HDF5::Type &type,
+               const std::optional<TransferMode> transferMode = {});
+
+    /**
+     * @brief Write a sub-dataset asynchronously.
+     *
+     * The write is queued on the I/O thread of PLI::HDF5::IOQueue and this
+     * method returns immediately, so the caller can compute the next tile
+     * while the data is written. Writes are executed in the order they were
+     * queued. Use PLI::HDF5::IOHandle::wait to wait for this write and to
+     * get its errors, or PLI::HDF5::File::waitAll to wait for all writes of a
+     * file. The write is only executed in the background if the HDF5
+     * library was built thread-safe and, when the file was opened with an
+     * MPI_Comm, if MPI was initialized with MPI_THREAD_MULTIPLE. Otherwise,
+     * it is executed before this method returns.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Data to write.
+     * @param hyperslab Area of the dataset to write.
+     * @param buffer Copy the data or write it from the caller's buffer.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return IOHandle Handle to wait for the write.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    template <typename T>
+    IOHandle writeAsync(const std::vector<T> &data, const Hyperslab &hyperslab,
+                        const AsyncBuffer buffer = AsyncBuffer::Copy,
+                        const std::optional<TransferMode> transferMode = {});
+
+    /**
+     * @brief Write a sub-dataset asynchronously.
+     *
+     * Same as the method above, but the data is kept alive by the write until
+     * it is finished instead of being copied.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Data to write.
+     * @param hyperslab Area of the dataset to write.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @return IOHandle Handle to wait for the write.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     */
+    template <typename T>
+    IOHandle writeAsync(std::shared_ptr<const std::vector<T>> data,
+                        const Hyperslab &hyperslab,
+                        const std::optional<TransferMode> transferMode = {});
 
     /**
      * @brief Get the type of the dataset.
      *
-     * @return const PLI::HDF5::Type Type of the dataset
+     * @return const PLI::HDF5::Type Copy of the type of the dataset, owned
+     * by the caller. Close it with H5Tclose when it is no longer needed.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
      * is not valid or the type doesn't exist.
      */
@@ -463,9 +1092,128 @@ class Dataset : public Object {
      * the dataspace of the dataset.
      */
     const std::vector<size_t> dims() const;
+    /**
+     * @brief Returns the maximum number of elements of the dataset.
+     * @return const std::vector<size_t> The maximum number of elements in each
+     * dimension. Dimensions without limit are PLI::HDF5::UNLIMITED.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * is not valid.
+     */
+    const std::vector<size_t> maxDims() const;
+
+    /**
+     * @brief Change the dimensions of the dataset.
+     *
+     * The new dimensions have to be within the maximum dimensions chosen when
+     * creating the dataset. Elements outside of the new dimensions are
+     * discarded, new elements are set to the fill value. Space on disk is only
+     * allocated when chunks are written.
+     * With MPI, all processes have to call this method with the same
+     * dimensions.
+     * @param newDims New dimensions of the dataset.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of dimensions differs from the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be extended, e.g. because it is not chunked or the new dimensions
+     * exceed the maximum dimensions.
+     */
+    void extend(const std::vector<size_t> &newDims);
+
+    /**
+     * @brief Append data at the end of an axis.
+     *
+     * The dataset is extended along the axis by the amount of data and the
+     * data is written to the new area. The data has to cover the full extent
+     * of all other dimensions, e.g. complete sections when appending to the
+     * last axis of a 3D stack.
+     * With MPI, all processes have to call this method with the same data.
+     * Only the first process of the communicator writes the data.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param data Data to append.
+     * @param axis Axis to extend.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the axis is
+     * invalid or the amount of data does not fit the other dimensions.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be extended or written.
+     */
+    template <typename T>
+    void append(const std::vector<T> &data, const size_t axis,
+                const std::optional<TransferMode> transferMode = {});
+
+    /**
+     * @brief Append data at the end of an axis.
+     *
+     * The dataset is extended along the axis by count elements and the data
+     * is written to the new area. The data has to cover the full extent of
+     * all other dimensions.
+     * With MPI, all processes have to call this method with the same count.
+     * Only the first process of the communicator writes the data.
+     * @param data Data to append.
+     * @param count Number of elements to append along the axis.
+     * @param axis Axis to extend.
+     * @param type Datatype of the data.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the axis is
+     * invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be extended or written.
+     */
+    void append(const void *data, const size_t count, const size_t axis,
+                const PLI::HDF5::Type &type,
+                const std::optional<TransferMode> transferMode = {});
+
+    /**
+     * @brief Reload the dataset metadata from the file.
+     *
+     * Readers of a file opened with PLI::HDF5::File::OpenState::SWMRRead call
+     * this method to pick up dimensions and data written by the SWMR writer
+     * since the dataset was opened or last refreshed.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be refreshed.
+     */
+    void refresh();
+    /**
+     * @brief Flush the data and metadata of the dataset to the file.
+     *
+     * In SWMR write mode, this makes new dimensions and data of the dataset
+     * visible to readers without flushing the whole file.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the dataset
+     * pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be flushed.
+     */
+    void flush();
 
     Dataset &operator=(const PLI::HDF5::Dataset &other) noexcept;
 
+    /**
+     * @brief Returns the grid of chunks covering the dataset.
+     *
+     * The hyperslabs of the chunks are computed on access, so the grid uses
+     * the same small amount of memory for any number of chunks.
+     * @return PLI::HDF5::ChunkGrid Grid of the chunks of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException if the
+     * dataset is not chunked.
+     */
+    ChunkGrid chunkGrid() const;
+
+    /**
+     * @brief Returns a grid of chunks with the given dimensions covering the
+     * dataset.
+     * @param chunkDims user defined chunk dimension of the data.
+     * @return PLI::HDF5::ChunkGrid Grid of chunks covering the dataset.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException if the
+     * the arguments dimensions are mismatched.
+     */
+    ChunkGrid chunkGrid(const std::vector<size_t> &chunkDims) const;
+
     /**
      * @brief Returns a vector of PLI::HDF5::Dataset::OffsetDim of the
      * dataset.
@@ -487,6 +1235,113 @@ class Dataset : public Object {
     std::vector<Hyperslab>
     getChunks(const std::vector<size_t> &chunkDims) const;
 
+    /**
+     * @brief Read a chunk as stored in the file.
+     *
+     * The chunk is read directly from the file, bypassing the filter
+     * pipeline. The returned bytes are therefore still compressed if filters
+     * are used by the dataset.
+     * Raw chunk access is not supported by HDF5 for files opened with MPI.
+     * @param offset Offset of the first element of the chunk. It has to be on
+     * a chunk boundary.
+     * @return RawChunk Stored bytes and filter mask of the chunk. If the chunk
+     * was not written yet, the data is empty.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the offset
+     * does not match the number of dimensions of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the chunk could
+     * not be read.
+     */
+    RawChunk readRawChunk(const std::vector<size_t> &offset) const;
+
+    /**
+     * @brief Write a chunk as it should be stored in the file.
+     *
+     * The bytes are written directly to the file, bypassing the datatype
+     * conversion and the filter pipeline. They have to be encoded by the
+     * filters of the dataset, except for filters marked in the filter mask.
+     * Raw chunk access is not supported by HDF5 for files opened with MPI.
+     * @param offset Offset of the first element of the chunk. It has to be on
+     * a chunk boundary.
+     * @param data Encoded bytes of the chunk.
+     * @param filterMask Bit i is set if filter i of the pipeline was not
+     * applied to the data.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the offset
+     * does not match the number of dimensions of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the chunk could
+     * not be written.
+     */
+    void writeRawChunk(const std::vector<size_t> &offset,
+                       const std::vector<uint8_t> &data,
+                       const uint32_t filterMask = 0);
+
+    /**
+     * @brief Copy the content of this dataset to another dataset.
+     *
+     * If both datasets share the chunk dimensions, datatype and filter
+     * pipeline, the chunks are copied as stored in the file without decoding
+     * and encoding them again. Otherwise, the data is read and written chunk
+     * by chunk. With MPI, the chunks are distributed among the processes of
+     * the communicator and all processes have to call this method.
+     * @param target Dataset with the same dimensions as this dataset.
+     * @return true The stored chunks were copied directly.
+     * @return false The data was copied through the filter pipeline.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * dimensions of both datasets differ.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the data could
+     * not be copied.
+     */
+    bool copyChunksTo(Dataset &target) const;
+
+    /**
+     * @brief Read the dataset chunk by chunk.
+     *
+     * Returns a range which reads one chunk after another into a typed
+     * buffer. While the caller processes a chunk, the next one is read on a
+     * background thread. See PLI::HDF5::ChunkRange for the restrictions of
+     * the background thread.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param chunkDims Dimensions of the chunks. If not set, the chunk
+     * dimensions of the dataset are used.
+     * @param prefetch Read the next chunk on a background thread.
+     * @return PLI::HDF5::ChunkRange<T> Range over all chunks of the dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If no chunk
+     * dimensions are given and the dataset is not chunked.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the chunk
+     * dimensions don't match the dataset dimensions.
+     */
+    template <typename T>
+    ChunkRange<T> chunks(const std::vector<size_t> &chunkDims = {},
+                         const bool prefetch = true) const;
+
+    /**
+     * @brief Returns a range reading the chunks of the dataset together with
+     * a border of neighbouring elements.
+     *
+     * Each chunk is read like readWithHalo. The part of the extended area
+     * which was already read for the previous chunk is copied from its buffer
+     * instead of being read again. This is the case for neighbouring chunks
+     * along one dimension, e.g. along a row of tiles. The chunks are read
+     * with TransferMode::Independent.
+     * @tparam T Type of the elements.
+     * @param halo Width of the border in each dimension.
+     * @param boundary Values of the border outside of the dataset.
+     * @param constant Value used with BoundaryMode::Constant.
+     * @param chunkDims Dimensions of the chunks without halo. If empty, the
+     * chunk dimensions of the dataset are used.
+     * @param prefetch Read the next chunk on a background thread.
+     * @return ChunkRange<T> Range of the chunks. The hyperslab of each chunk
+     * is the area without halo, its data covers the extended area.
+     */
+    template <typename T>
+    ChunkRange<T>
+    chunksWithHalo(const std::vector<size_t> &halo,
+                   const BoundaryMode boundary = BoundaryMode::Clamp,
+                   const T &constant = T(),
+                   const std::vector<size_t> &chunkDims = {},
+                   const bool prefetch = true) const;
+
     /**
      * @brief HDF5 Dataset Slice object.
      * Slice object inspired by python.
@@ -569,10 +1424,16 @@ class Dataset : public Object {
 
     /**
      * @brief HDF5 Dataset Hyperslap object for chunking and slicing.
-     * Hyperslap object for HDF5 for chunking and slicing.
+     * Hyperslap object for HDF5 for chunking and slicing. Offset, count and
+     * stride of up to four dimensions are stored inline and use the element
+     * type of HDF5, so they are passed to HDF5 without any allocation or
+     * conversion.
      */
     class Hyperslab {
       public:
+        /// Offset, count or stride of a hyperslab.
+        using Extent = SmallVector<hsize_t, 4>;
+
         Hyperslab() = default;
         Hyperslab(Hyperslab &&) = default;
         Hyperslab(const Hyperslab &) = default;
@@ -582,9 +1443,8 @@ class Dataset : public Object {
 
         explicit Hyperslab(const Slice &slice);
         Hyperslab(size_t offset, size_t count, size_t stride = 1);
-        Hyperslab(const std::vector<size_t> &offset,
-                  const std::vector<size_t> &count,
-                  const std::vector<size_t> &stride = {});
+        Hyperslab(const Extent &offset, const Extent &count,
+                  const Extent &stride = {});
 
         bool operator==(const Hyperslab &hyperslab) const;
         bool operator!=(const Hyperslab &hyperslab) const;
@@ -603,9 +1463,9 @@ class Dataset : public Object {
             return out;
         }
 
-        const std::vector<size_t> &offset() const { return m_offset; }
-        const std::vector<size_t> &count() const { return m_count; }
-        const std::vector<size_t> &stride() const { return m_stride; }
+        const Extent &offset() const { return m_offset; }
+        const Extent &count() const { return m_count; }
+        const Extent &stride() const { return m_stride; }
 
         void push_back(size_t offset, size_t count, size_t stride = 1);
         void clear();
@@ -614,9 +1474,9 @@ class Dataset : public Object {
         Slices toSlices() const;
 
       private:
-        std::vector<size_t> m_offset;
-        std::vector<size_t> m_count;
-        std::vector<size_t> m_stride;
+        Extent m_offset;
+        Extent m_count;
+        Extent m_stride;
     };
 
     static std::vector<PLI::HDF5::Dataset::Hyperslab>
@@ -624,9 +1484,81 @@ class Dataset : public Object {
                 const PLI::HDF5::Dataset::Hyperslab &chunk_hyperslab);
 
   private:
-    hid_t createXfID() const;
+    friend class DatasetGroupIO;
+    template <typename T> friend class ChunkRange;
+
+    IOHandle submitAsync(std::function<void(Dataset &)> operation) const;
+
+    /// Filter ID of the bitshuffle plugin.
+    static constexpr H5Z_filter_t BITSHUFFLE_FILTER = 32008;
+    /// Filter ID of the LZ4 plugin.
+    static constexpr H5Z_filter_t LZ4_FILTER = 32004;
+    /// Filter ID of the Zstandard plugin.
+    static constexpr H5Z_filter_t ZSTD_FILTER = 32015;
+
+    static void setFilters(const hid_t dcpl_id,
+                           const DatasetCreateOptions &options);
+    static bool filterAvailable(const H5Z_filter_t filter);
+    static hid_t createAccessPlist(const DatasetAccessOptions &options,
+                                   const std::vector<size_t> &dims,
+                                   const std::vector<size_t> &chunkDims,
+                                   const size_t typeSize);
+    static bool sameFilters(const hid_t dcpl_id, const hid_t otherDcpl_id);
+    /// Upper limit of the staging buffer of one readMany batch.
+    static constexpr size_t READ_MANY_BATCH_BYTES = 64 * 1024 * 1024;
+
+    bool canCopyRawChunks(const Dataset &target) const;
+    bool mapRegion(MappedRegion &region, const PLI::HDF5::Type &type,
+                   const size_t alignment, const MapAdvice advice) const;
+    void readHaloRegion(void *const data, const Hyperslab &tile,
+                        const std::vector<size_t> &halo,
+                        const BoundaryMode boundary,
+                        const PLI::HDF5::Type &type,
+                        const std::optional<TransferMode> transferMode,
+                        const void *previousData = nullptr,
+                        const Hyperslab *previousTile = nullptr) const;
+    void readManyBatch(std::span<const Hyperslab> hyperslabs,
+                       std::span<void *const> outputs,
+                       const std::vector<size_t> &batch,
+                       const PLI::HDF5::Type &type,
+                       const std::optional<TransferMode> transferMode) const;
+    hid_t transferPlist(const std::optional<TransferMode> transferMode) const;
+    static void selectHyperslab(hid_t dataspacePtr, hid_t memspacePtr,
+                                const Hyperslab &hyperslab);
+
+    /**
+     * @brief Metadata of the dataset which does not change between reads and
+     * writes. Copies of a dataset object share the same metadata.
+     */
+    struct Metadata {
+        Metadata();
+        ~Metadata();
+        Metadata(const Metadata &) = delete;
+        Metadata &operator=(const Metadata &) = delete;
+
+        /// Guards the lazy initialization, e.g. from prefetching iterators.
+        std::mutex mutex;
+        /// True if the fields below describe the current dataset extent.
+        bool loaded = false;
+        std::vector<size_t> dims;
+        std::vector<size_t> maxDims;
+        std::vector<size_t> chunkDims;
+        bool chunked = false;
+        /// On-disk datatype of the dataset.
+        hid_t typeID = H5I_INVALID_HID;
+        /// Transfer property list of each MPI transfer mode.
+        std::array<hid_t, 4> transferPlists;
+    };
+    Metadata &metadata() const;
+    void resetMetadata();
+    void invalidateMetadata();
+
+    mutable std::shared_ptr<Metadata> m_metadata;
 };
 } // namespace HDF5
 } // namespace PLI
 
 #include "PLIHDF5/dataset.tpp"
+
+// Includes PLIHDF5/chunks.h, which depends on both Dataset and ChunkGrid.
+#include "PLIHDF5/chunkgrid.h"
@@ -27,47 +27,87 @@ void PLI::HDF5::Dataset::create(const Folder &parentPtr,
 }
 
 template <typename T>
-std::vector<T> PLI::HDF5::Dataset::readFullDataset() const {
+PLI::HDF5::Dataset
+PLI::HDF5::Folder::createDataset(const std::string &datasetName,
+                                 const std::vector<size_t> &dims,
+                                 std::initializer_list<size_t> chunkDims) {
+    return this->createDataset<T>(datasetName, dims,
+                                  std::vector<size_t>(chunkDims));
+}
+
+template <typename T>
+void PLI::HDF5::Dataset::create(const Folder &parentPtr,
+                                const std::string &datasetName,
+                                const std::vector<size_t> &dims,
+                                std::initializer_list<size_t> chunkDims) {
+    this->create<T>(parentPtr, datasetName, dims,
+                    std::vector<size_t>(chunkDims));
+}
+
+template <typename T>
+PLI::HDF5::Dataset PLI::HDF5::Folder::createDataset(
+    const std::string &datasetName, const std::vector<size_t> &dims,
+    const DatasetCreateOptions &options) {
+    PLI::HDF5::Dataset dataset;
+    dataset.create<T>(*this, datasetName, dims, options);
+    return dataset;
+}
+
+template <typename T>
+void PLI::HDF5::Dataset::create(const Folder &parentPtr,
+                                const std::string &datasetName,
+                                const std::vector<size_t> &dims,
+                                const DatasetCreateOptions &options) {
+    PLI::HDF5::Type dataType = PLI::HDF5::Type::createType<T>();
+    this->create(parentPtr, datasetName, dims, options, dataType);
+}
+
+template <typename T, typename Allocator>
+std::vector<T, Allocator> PLI::HDF5::Dataset::readFullDataset(
+    const std::optional<TransferMode> transferMode) const {
+    const std::vector<size_t> _dims = this->dims();
+    std::vector<T, Allocator> returnData;
+    returnData.resize(std::accumulate(_dims.begin(), _dims.end(), size_t{1},
+                                      std::multiplies<std::size_t>()));
+    this->readFullDataset(std::span<T>(returnData), transferMode);
+    return returnData;
+}
+
+template <typename T>
+void PLI::HDF5::Dataset::readFullDataset(
+    std::span<T> data, const std::optional<TransferMode> transferMode) const {
     checkHDF5Ptr(this->m_id, "Dataset ID");
+    std::vector<size_t> _dims = this->dims();
+    if (data.size() != std::accumulate(_dims.begin(), _dims.end(), size_t{1},
+                                       std::multiplies<std::size_t>())) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Buffer size does not match the number of elements of the "
+            "dataset.");
+    }
     hid_t dataspacePtr = H5Dget_space(this->m_id);
     checkHDF5Ptr(dataspacePtr, "H5Dget_space");
-    hsize_t sumOfElements;
-    sumOfElements = H5Sget_simple_extent_npoints(dataspacePtr);
 
-    std::vector<size_t> _dims = this->dims();
     std::vector<hsize_t> _dims_hdf5(_dims.begin(), _dims.end());
-    std::vector<T> returnData;
-    returnData.resize(sumOfElements);
-
     PLI::HDF5::Type returnType = PLI::HDF5::Type::createType<T>();
 
-    hid_t xf_id = createXfID();
+    hid_t xf_id = transferPlist(transferMode);
     hid_t memspacePtr =
         H5Screate_simple(_dims_hdf5.size(), _dims_hdf5.data(), nullptr);
     checkHDF5Ptr(memspacePtr, "H5Screate_simple");
     checkHDF5Call(H5Dread(this->m_id, returnType, memspacePtr, dataspacePtr,
-                          xf_id, returnData.data()),
+                          xf_id, data.data()),
                   "H5Dread");
 
-    checkHDF5Call(H5Pclose(xf_id), "H5Pclose");
     checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
     checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
-    return returnData;
 }
 
-template <typename T>
-std::vector<T>
+template <typename T, typename Allocator>
+std::vector<T, Allocator>
 PLI::HDF5::Dataset::read(const std::vector<size_t> &offset,
                          const std::vector<size_t> &count,
-                         const std::vector<size_t> &stride) const {
-    // Convert offset and count to hsize_t arrays for H5Sselect_hyperslab
-    std::vector<hsize_t> _offset(offset.begin(), offset.end());
-    std::vector<hsize_t> _count(count.begin(), count.end());
-    std::vector<hsize_t> _stride(offset.size(), 1);
-    if (!stride.empty()) {
-        _stride = std::vector<hsize_t>(stride.begin(), stride.end());
-    }
-
+                         const std::vector<size_t> &stride,
+                         const std::optional<TransferMode> transferMode) const {
     size_t numElements = std::accumulate(count.begin(), count.end(), 1ull,
                                          std::multiplies<std::size_t>());
     // Check for possible error with MPI because too many elements are requested
@@ -80,44 +120,32 @@ PLI::HDF5::Dataset::read(const std::vector<size_t> &offset,
             "MPI! Consider using chunk iterators or read the dataset in "
             "selected amounts.");
     }
+    return this->read<T, Allocator>(Hyperslab(offset, count, stride),
+                                    transferMode);
+}
 
-    checkHDF5Ptr(this->m_id, "Dataset ID");
-    hid_t dataspacePtr = H5Dget_space(this->m_id);
-    checkHDF5Ptr(dataspacePtr, "H5Dget_space");
-    PLI::HDF5::Type returnType = PLI::HDF5::Type::createType<T>();
-    hid_t memspacePtr = H5Screate_simple(_count.size(), _count.data(), nullptr);
-    checkHDF5Ptr(memspacePtr, "H5Screate_simple");
-
-    std::vector<T> returnData;
-    returnData.resize(numElements);
-
-    hid_t xf_id = createXfID();
-    checkHDF5Call(H5Sselect_hyperslab(dataspacePtr, H5S_SELECT_SET,
-                                      _offset.data(), _stride.data(),
-                                      _count.data(), nullptr),
-                  "H5Sselect_hyperslab");
-    checkHDF5Call(H5Dread(this->m_id, returnType, memspacePtr, dataspacePtr,
-                          xf_id, returnData.data()),
-                  "H5Dread");
-
-    checkHDF5Call(H5Pclose(xf_id), "H5Pclose");
-    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
-    checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
-    return returnData;
+template <typename T>
+void PLI::HDF5::Dataset::read(
+    std::span<T> data, const std::vector<size_t> &offset,
+    const std::vector<size_t> &count, const std::vector<size_t> &stride,
+    const std::optional<TransferMode> transferMode) const {
+    this->read(data, Hyperslab(offset, count, stride), transferMode);
 }
 
 template <typename T>
-void PLI::HDF5::Dataset::read(T *const data, const std::vector<size_t> &offset,
-                              const std::vector<size_t> &count,
-                              const std::vector<size_t> &stride) const {
-    // Convert offset and count to hsize_t arrays for H5Sselect_hyperslab
-    std::vector<hsize_t> _offset(offset.begin(), offset.end());
-    std::vector<hsize_t> _count(count.begin(), count.end());
-    std::vector<hsize_t> _stride(offset.size(), 1);
-    if (!stride.empty()) {
-        _stride = std::vector<hsize_t>(stride.begin(), stride.end());
-    }
+void PLI::HDF5::Dataset::read(
+    T *const data, const std::vector<size_t> &offset,
+    const std::vector<size_t> &count, const std::vector<size_t> &stride,
+    const std::optional<TransferMode> transferMode) const {
+    this->read(static_cast<void *>(data), Hyperslab(offset, count, stride),
+               PLI::HDF5::Type::createType<T>(), transferMode);
+}
 
+template <typename T, typename Allocator>
+std::vector<T, Allocator>
+PLI::HDF5::Dataset::read(const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                         const std::optional<TransferMode> transferMode) const {
+    const Hyperslab::Extent &count = hyperslab.count();
     size_t numElements = std::accumulate(count.begin(), count.end(), 1ull,
                                          std::multiplies<std::size_t>());
     // Check for possible error with MPI because too many elements are requested
@@ -131,69 +159,237 @@ void PLI::HDF5::Dataset::read(T *const data, const std::vector<size_t> &offset,
             "selected amounts.");
     }
 
-    checkHDF5Ptr(this->m_id, "Dataset ID");
-    hid_t dataspacePtr = H5Dget_space(this->m_id);
-    checkHDF5Ptr(dataspacePtr, "H5Dget_space");
-    PLI::HDF5::Type returnType = PLI::HDF5::Type::createType<T>();
-    hid_t memspacePtr = H5Screate_simple(_count.size(), _count.data(), nullptr);
-    checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+    std::vector<T, Allocator> returnData;
+    returnData.resize(numElements);
+    this->read(std::span<T>(returnData), hyperslab, transferMode);
+    return returnData;
+}
 
-    hid_t xf_id = createXfID();
-    checkHDF5Call(H5Sselect_hyperslab(dataspacePtr, H5S_SELECT_SET,
-                                      _offset.data(), _stride.data(),
-                                      _count.data(), nullptr),
-                  "H5Sselect_hyperslab");
-    checkHDF5Call(
-        H5Dread(this->m_id, returnType, memspacePtr, dataspacePtr, xf_id, data),
-        "H5Dread");
+template <typename T>
+void PLI::HDF5::Dataset::read(
+    std::span<T> data, const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const std::optional<TransferMode> transferMode) const {
+    const Hyperslab::Extent &count = hyperslab.count();
+    if (data.size() != std::accumulate(count.begin(), count.end(), size_t{1},
+                                       std::multiplies<std::size_t>())) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Buffer size does not match the number of selected elements.");
+    }
+    this->read(static_cast<void *>(data.data()), hyperslab,
+               PLI::HDF5::Type::createType<T>(), transferMode);
+}
 
-    checkHDF5Call(H5Pclose(xf_id), "H5Pclose");
-    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
-    checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+template <typename T>
+void PLI::HDF5::Dataset::read(
+    T *const data, const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const std::optional<TransferMode> transferMode) const {
+    this->read(static_cast<void *>(data), hyperslab,
+               PLI::HDF5::Type::createType<T>(), transferMode);
+}
+
+template <typename T, typename Allocator>
+std::vector<std::vector<T, Allocator>> PLI::HDF5::Dataset::readMany(
+    std::span<const PLI::HDF5::Dataset::Hyperslab> hyperslabs,
+    const std::optional<TransferMode> transferMode) const {
+    std::vector<std::vector<T, Allocator>> returnData(hyperslabs.size());
+    std::vector<std::span<T>> outputs(hyperslabs.size());
+    for (size_t i = 0; i < hyperslabs.size(); ++i) {
+        const auto &count = hyperslabs[i].count();
+        returnData[i].resize(std::accumulate(count.begin(), count.end(),
+                                             size_t{1},
+                                             std::multiplies<std::size_t>()));
+        outputs[i] = std::span<T>(returnData[i]);
+    }
+    this->readMany(hyperslabs, std::span<const std::span<T>>(outputs),
+                   transferMode);
+    return returnData;
 }
 
 template <typename T>
-std::vector<T>
-PLI::HDF5::Dataset::read(const PLI::HDF5::Dataset::Hyperslab &hyperslab) const {
-    return this->read<T>(hyperslab.offset(), hyperslab.count(),
-                         hyperslab.stride());
+void PLI::HDF5::Dataset::readMany(
+    std::span<const PLI::HDF5::Dataset::Hyperslab> hyperslabs,
+    std::span<const std::span<T>> outputs,
+    const std::optional<TransferMode> transferMode) const {
+    if (outputs.size() != hyperslabs.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Number of buffers does not match the number of hyperslabs.");
+    }
+    std::vector<void *> pointers(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        const auto &count = hyperslabs[i].count();
+        if (outputs[i].size() !=
+            std::accumulate(count.begin(), count.end(), size_t{1},
+                            std::multiplies<std::size_t>())) {
+            throw PLI::HDF5::Exceptions::DimensionMismatchException(
+                "Buffer size does not match the number of selected "
+                "elements.");
+        }
+        pointers[i] = static_cast<void *>(outputs[i].data());
+    }
+    this->readMany(hyperslabs, std::span<void *const>(pointers),
+                   PLI::HDF5::Type::createType<T>(), transferMode);
+}
+
+template <typename T, typename Allocator>
+std::vector<T, Allocator> PLI::HDF5::Dataset::readPoints(
+    std::span<const size_t> coordinates,
+    const std::optional<TransferMode> transferMode) const {
+    std::vector<T, Allocator> returnData;
+    returnData.resize(coordinates.size() / std::max(1, this->ndims()));
+    this->readPoints(std::span<T>(returnData), coordinates, transferMode);
+    return returnData;
 }
 
 template <typename T>
-void PLI::HDF5::Dataset::read(
-    T *const data, const PLI::HDF5::Dataset::Hyperslab &hyperslab) const {
-    return this->read<T>(data, hyperslab.offset(), hyperslab.count(),
-                         hyperslab.stride());
+void PLI::HDF5::Dataset::readPoints(
+    std::span<T> data, std::span<const size_t> coordinates,
+    const std::optional<TransferMode> transferMode) const {
+    if (data.size() * this->ndims() != coordinates.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Buffer size does not match the number of points.");
+    }
+    this->readPoints(static_cast<void *>(data.data()), coordinates,
+                     PLI::HDF5::Type::createType<T>(), transferMode);
+}
+
+template <typename T, typename Allocator>
+std::vector<T, Allocator> PLI::HDF5::Dataset::readWithHalo(
+    const PLI::HDF5::Dataset::Hyperslab &tile, const std::vector<size_t> &halo,
+    const BoundaryMode boundary, const T &constant,
+    const std::optional<TransferMode> transferMode) const {
+    if (tile.size() != halo.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Tile and halo must have the same number of dimensions.");
+    }
+    size_t numElements = 1;
+    for (size_t i = 0; i < halo.size(); ++i) {
+        numElements *= tile.count()[i] + 2 * halo[i];
+    }
+    std::vector<T, Allocator> returnData;
+    returnData.resize(numElements);
+    this->readWithHalo(std::span<T>(returnData), tile, halo, boundary,
+                       constant, transferMode);
+    return returnData;
+}
+
+template <typename T>
+void PLI::HDF5::Dataset::readWithHalo(
+    std::span<T> data, const PLI::HDF5::Dataset::Hyperslab &tile,
+    const std::vector<size_t> &halo, const BoundaryMode boundary,
+    const T &constant, const std::optional<TransferMode> transferMode) const {
+    if (tile.size() != halo.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Tile and halo must have the same number of dimensions.");
+    }
+    size_t numElements = 1;
+    for (size_t i = 0; i < halo.size(); ++i) {
+        numElements *= tile.count()[i] + 2 * halo[i];
+    }
+    if (data.size() != numElements) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Buffer size does not match the tile with halo.");
+    }
+    if (boundary == BoundaryMode::Constant) {
+        std::fill(data.begin(), data.end(), constant);
+    }
+    this->readHaloRegion(static_cast<void *>(data.data()), tile, halo,
+                         boundary, PLI::HDF5::Type::createType<T>(),
+                         transferMode);
+}
+
+template <typename T>
+PLI::HDF5::MappedView<T>
+PLI::HDF5::Dataset::mapReadOnly(const MapAdvice advice) const {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::mapReadOnly");
+    PLI::HDF5::MappedRegion region;
+    if (this->mapRegion(region, PLI::HDF5::Type::createType<T>(), alignof(T),
+                        advice)) {
+        return PLI::HDF5::MappedView<T>(std::move(region), this->dims());
+    }
+    std::vector<T> data = this->readFullDataset<T>();
+    return PLI::HDF5::MappedView<T>(std::move(data), this->dims());
 }
 
 template <typename T>
 void PLI::HDF5::Dataset::write(const std::vector<T> &data,
                                const std::vector<size_t> &offset,
                                const std::vector<size_t> &dims,
-                               const std::vector<size_t> &stride) {
-    this->write<T>(data.data(), offset, dims, stride);
+                               const std::vector<size_t> &stride,
+                               const std::optional<TransferMode> transferMode) {
+    this->write<T>(data.data(), offset, dims, stride, transferMode);
 }
 
 template <typename T>
 void PLI::HDF5::Dataset::write(const void *data,
                                const std::vector<size_t> &offset,
                                const std::vector<size_t> &dims,
-                               const std::vector<size_t> &stride) {
-    this->write(data, offset, dims, stride, PLI::HDF5::Type::createType<T>());
+                               const std::vector<size_t> &stride,
+                               const std::optional<TransferMode> transferMode) {
+    this->write(data, offset, dims, stride, PLI::HDF5::Type::createType<T>(),
+                transferMode);
 }
 
 template <typename T>
 void PLI::HDF5::Dataset::write(const std::vector<T> &data,
-                               const PLI::HDF5::Dataset::Hyperslab &hyperslab) {
+                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                               const std::optional<TransferMode> transferMode) {
 
-    this->write(data.data(), hyperslab.offset(), hyperslab.count(),
-                hyperslab.stride(), PLI::HDF5::Type::createType<T>());
+    this->write(data.data(), hyperslab, PLI::HDF5::Type::createType<T>(),
+                transferMode);
 }
 
 template <typename T>
 void PLI::HDF5::Dataset::write(const void *data,
-                               const PLI::HDF5::Dataset::Hyperslab &hyperslab) {
+                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                               const std::optional<TransferMode> transferMode) {
+
+    this->write(data, hyperslab, PLI::HDF5::Type::createType<T>(),
+                transferMode);
+}
+
+template <typename T>
+PLI::HDF5::IOHandle
+PLI::HDF5::Dataset::writeAsync(const std::vector<T> &data,
+                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                               const AsyncBuffer buffer,
+                               const std::optional<TransferMode> transferMode) {
+    if (buffer == AsyncBuffer::Copy) {
+        return this->writeAsync(std::make_shared<const std::vector<T>>(data),
+                                hyperslab, transferMode);
+    }
+    const std::vector<T> *borrowed = &data;
+    return this->submitAsync([borrowed, hyperslab, transferMode](
+                                 Dataset &dataset) {
+        dataset.write(*borrowed, hyperslab, transferMode);
+    });
+}
 
-    this->write(data, hyperslab.offset(), hyperslab.count(), hyperslab.stride(),
-                PLI::HDF5::Type::createType<T>());
+template <typename T>
+PLI::HDF5::IOHandle
+PLI::HDF5::Dataset::writeAsync(std::shared_ptr<const std::vector<T>> data,
+                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                               const std::optional<TransferMode> transferMode) {
+    return this->submitAsync(
+        [data, hyperslab, transferMode](Dataset &dataset) {
+            dataset.write(*data, hyperslab, transferMode);
+        });
+}
+
+template <typename T>
+void PLI::HDF5::Dataset::append(const std::vector<T> &data, const size_t axis,
+                                const std::optional<TransferMode> transferMode) {
+    std::vector<size_t> _dims = this->dims();
+    if (axis >= _dims.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Axis exceeds the number of dimensions of the dataset.");
+    }
+    _dims[axis] = 1;
+    const size_t sliceElements = std::accumulate(
+        _dims.begin(), _dims.end(), 1ull, std::multiplies<std::size_t>());
+    if (sliceElements == 0 || data.size() % sliceElements != 0) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Data does not cover the other dimensions of the dataset.");
+    }
+    this->append(data.data(), data.size() / sliceElements, axis,
+                 PLI::HDF5::Type::createType<T>(), transferMode);
 }
@@ -0,0 +1,189 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <optional>
+#include <span>
+#include <vector>
+
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/options.h"
+#include "PLIHDF5/type.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Read or write the same hyperslab of several datasets at once.
+ *
+ * Useful for co-registered maps of one section, e.g. transmittance,
+ * direction, retardation and inclination, which are always accessed at the
+ * same region. With HDF5 1.14 or newer, all datasets are accessed with one
+ * call to H5Dread_multi / H5Dwrite_multi, so collective MPI-IO only
+ * synchronizes once. Older versions access the datasets one after another,
+ * sharing the memory dataspace and transfer property list. These accesses
+ * are not overlapped.
+ * The hyperslab is checked against all datasets before any of them is
+ * accessed.
+ * The transfer mode defaults to the transfer mode of the first dataset.
+ */
+class DatasetGroupIO {
+  public:
+    DatasetGroupIO() = default;
+    /**
+     * @brief Construct a new DatasetGroupIO object
+     * @param datasets Datasets accessed together.
+     */
+    explicit DatasetGroupIO(const std::vector<Dataset> &datasets);
+
+    /**
+     * @brief Add a dataset to the group.
+     * @param dataset Dataset accessed together with the others.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the
+     * dataset is not valid.
+     */
+    void add(const Dataset &dataset);
+    /**
+     * @brief Returns the number of datasets of the group.
+     * @return size_t Number of datasets.
+     */
+    size_t size() const noexcept;
+    /**
+     * @brief Returns the datasets of the group.
+     * @return const std::vector<Dataset>& Datasets in the order they were
+     * added.
+     */
+    const std::vector<Dataset> &datasets() const noexcept;
+
+    /**
+     * @brief Read the same hyperslab of all datasets.
+     * @tparam T Type of the elements.
+     * @tparam Allocator Allocator of the returned vectors.
+     * @param hyperslab Area to read.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the first dataset is used.
+     * @return std::vector<std::vector<T, Allocator>> One vector per dataset.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * hyperslab doesn't match the dimensions of a dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a dataset could
+     * not be read.
+     */
+    template <typename T, typename Allocator = std::allocator<T>>
+    std::vector<std::vector<T, Allocator>>
+    read(const Dataset::Hyperslab &hyperslab,
+         const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read the same hyperslab of all datasets into caller-owned
+     * buffers.
+     * @tparam T Type of the elements.
+     * @param outputs One buffer per dataset. Each buffer has to hold exactly
+     * the number of elements of the hyperslab.
+     * @param hyperslab Area to read.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the first dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * or the size of the buffers or the hyperslab doesn't match.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a dataset could
+     * not be read.
+     */
+    template <typename T>
+    void read(std::span<const std::span<T>> outputs,
+              const Dataset::Hyperslab &hyperslab,
+              const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Read the same hyperslab of all datasets into pointers.
+     * @param outputs One pointer per dataset, each holding enough memory for
+     * all elements of the hyperslab.
+     * @param hyperslab Area to read.
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the first dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of pointers doesn't match the number of datasets or the hyperslab
+     * doesn't match the dimensions of a dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a dataset could
+     * not be read.
+     */
+    void read(std::span<void *const> outputs,
+              const Dataset::Hyperslab &hyperslab, const PLI::HDF5::Type &type,
+              const std::optional<TransferMode> transferMode = {}) const;
+
+    /**
+     * @brief Write the same hyperslab of all datasets.
+     * @tparam T Type of the elements.
+     * @param data One vector per dataset. Each vector has to hold exactly the
+     * number of elements of the hyperslab.
+     * @param hyperslab Area to write.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the first dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * or the size of the vectors or the hyperslab doesn't match.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a dataset could
+     * not be written.
+     */
+    template <typename T>
+    void write(const std::vector<std::vector<T>> &data,
+               const Dataset::Hyperslab &hyperslab,
+               const std::optional<TransferMode> transferMode = {});
+
+    /**
+     * @brief Write the same hyperslab of all datasets from pointers.
+     * @param data One pointer per dataset, each holding all elements of the
+     * hyperslab.
+     * @param hyperslab Area to write.
+     * @param type Datatype of the data in memory.
+     * @param transferMode MPI-IO transfer mode of this call. If not set, the
+     * transfer mode of the first dataset is used.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the number
+     * of pointers doesn't match the number of datasets or the hyperslab
+     * doesn't match the dimensions of a dataset.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a dataset could
+     * not be written.
+     */
+    void write(std::span<const void *const> data,
+               const Dataset::Hyperslab &hyperslab,
+               const PLI::HDF5::Type &type,
+               const std::optional<TransferMode> transferMode = {});
+
+  private:
+    void transfer(bool isRead, std::span<void *const> buffers,
+                  const Dataset::Hyperslab &hyperslab,
+                  const PLI::HDF5::Type &type,
+                  const std::optional<TransferMode> transferMode) const;
+
+    std::vector<Dataset> m_datasets;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/datasetgroupio.tpp"
@@ -0,0 +1,91 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "PLIHDF5/datasetgroupio.h"
+
+#include <numeric>
+
+#include "PLIHDF5/exceptions.h"
+
+template <typename T, typename Allocator>
+std::vector<std::vector<T, Allocator>> PLI::HDF5::DatasetGroupIO::read(
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const std::optional<TransferMode> transferMode) const {
+    const auto &count = hyperslab.count();
+    const size_t numElements = std::accumulate(
+        count.begin(), count.end(), size_t{1}, std::multiplies<std::size_t>());
+    std::vector<std::vector<T, Allocator>> returnData(m_datasets.size());
+    std::vector<std::span<T>> outputs(m_datasets.size());
+    for (size_t i = 0; i < m_datasets.size(); ++i) {
+        returnData[i].resize(numElements);
+        outputs[i] = std::span<T>(returnData[i]);
+    }
+    this->read(std::span<const std::span<T>>(outputs), hyperslab,
+               transferMode);
+    return returnData;
+}
+
+template <typename T>
+void PLI::HDF5::DatasetGroupIO::read(
+    std::span<const std::span<T>> outputs,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const std::optional<TransferMode> transferMode) const {
+    const auto &count = hyperslab.count();
+    const size_t numElements = std::accumulate(
+        count.begin(), count.end(), size_t{1}, std::multiplies<std::size_t>());
+    std::vector<void *> pointers(outputs.size());
+    for (size_t i = 0; i < outputs.size(); ++i) {
+        if (outputs[i].size() != numElements) {
+            throw PLI::HDF5::Exceptions::DimensionMismatchException(
+                "Buffer size does not match the number of selected "
+                "elements.");
+        }
+        pointers[i] = static_cast<void *>(outputs[i].data());
+    }
+    this->read(std::span<void *const>(pointers), hyperslab,
+               PLI::HDF5::Type::createType<T>(), transferMode);
+}
+
+template <typename T>
+void PLI::HDF5::DatasetGroupIO::write(
+    const std::vector<std::vector<T>> &data,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const std::optional<TransferMode> transferMode) {
+    const auto &count = hyperslab.count();
+    const size_t numElements = std::accumulate(
+        count.begin(), count.end(), size_t{1}, std::multiplies<std::size_t>());
+    std::vector<const void *> pointers(data.size());
+    for (size_t i = 0; i < data.size(); ++i) {
+        if (data[i].size() != numElements) {
+            throw PLI::HDF5::Exceptions::DimensionMismatchException(
+                "Data size does not match the number of selected elements.");
+        }
+        pointers[i] = static_cast<const void *>(data[i].data());
+    }
+    this->write(std::span<const void *const>(pointers), hyperslab,
+                PLI::HDF5::Type::createType<T>(), transferMode);
+}
@@ -184,6 +184,17 @@ class HDF5RuntimeException : public std::exception {
   private:
     std::string m_message;
 };
+
+class FilterNotAvailableException : public std::exception {
+  public:
+    explicit FilterNotAvailableException(const std::string &message)
+        : std::exception(), m_message(message) {}
+    virtual ~FilterNotAvailableException() noexcept {}
+    virtual const char *what() const noexcept { return m_message.c_str(); }
+
+  private:
+    std::string m_message;
+};
 } // namespace Exceptions
 void checkHDF5Call(const herr_t hdf5ReturnValue,
                    const std::string &message = "None");
@@ -28,11 +28,15 @@
 #include <hdf5.h>
 #include <mpi.h>
 
+#include <cstddef>
 #include <filesystem>
 #include <optional>
+#include <span>
 #include <string>
+#include <vector>
 
 #include "PLIHDF5/object.h"
+#include "PLIHDF5/options.h"
 
 /**
  * @brief The PLI namespace
@@ -48,7 +52,7 @@ namespace HDF5 {
  */
 class File : public Folder {
   public:
-    enum class OpenState { ReadOnly = 0, ReadWrite = 1 };
+    enum class OpenState { ReadOnly = 0, ReadWrite = 1, SWMRRead = 2 };
     enum class CreateState { OverrideExisting = 0, FailIfExists = 1 };
 
     /**
@@ -86,6 +90,9 @@ class File : public Folder {
      * @param fileName File name.
      * @param communicator If an MPI_Comm is set, the file will be opened with
      * MPI access. Actions need to be done collectively.
+     * @param accessOptions MPI-IO hints and file access tuning. If not set,
+     * the "file_access" section of the PLI::HDF5::Config file is used.
+     * @param createOptions File space strategy of the new file.
      * @throw PLI::HDF5::Exceptions::FileExistsException If the file already
      * exists.
      * @throw PLI::HDF5::Exceptions::IdentifierNotValidException If the file
@@ -94,7 +101,9 @@ class File : public Folder {
      * the MPI file access.
      */
     void create(const std::string &fileName, const CreateState creationState,
-                const std::optional<MPI_Comm> communicator = {});
+                const std::optional<MPI_Comm> communicator = {},
+                const std::optional<FileAccessOptions> &accessOptions = {},
+                const FileCreateOptions &createOptions = {});
     /**
      * @brief Open an existing file.
      *
@@ -104,13 +113,19 @@ class File : public Folder {
      * read-only mode or in read-write mode. Setting openState to
      * PLI::HDF5::File::OpenState::ReadOnly will open the file in read-only
      * mode. Setting openState to PLI::HDF5::File::OpenState::ReadWrite will
-     * open the file in read-write mode.
+     * open the file in read-write mode. Setting openState to
+     * PLI::HDF5::File::OpenState::SWMRRead will open the file read-only while
+     * another process writes to it in SWMR mode.
      * @param fileName File name which will be opened.
      * @param openState OpenState variable. Available values are
-     * PLI::HDF5::File::OpenState::ReadOnly and
-     * PLI::HDF5::File::OpenState::ReadWrite.
+     * PLI::HDF5::File::OpenState::ReadOnly,
+     * PLI::HDF5::File::OpenState::ReadWrite and
+     * PLI::HDF5::File::OpenState::SWMRRead.
      * @param communicator If an MPI_Comm is set, the file will be opened with
      * MPI access.
+     * @param accessOptions MPI-IO hints and file access tuning. If not set,
+     * the "file_access" section of the PLI::HDF5::Config file is used. A page
+     * buffer is only used if the file was created with paged aggregation.
      * @throws PLI::HDF5::Exceptions::FileNotFoundException If the file doesn't
      * exist.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the file
@@ -121,7 +136,83 @@ class File : public Folder {
      * not a valid HDF5 file.
      */
     void open(const std::string &fileName, const OpenState openState,
-              const std::optional<MPI_Comm> communicator = {});
+              const std::optional<MPI_Comm> communicator = {},
+              const std::optional<FileAccessOptions> &accessOptions = {});
+
+    /**
+     * @brief Create a new file in memory.
+     *
+     * The file is created with the core file driver (H5FD_CORE) and kept
+     * completely in memory, e.g. for intermediate results which are read
+     * back shortly after. In-memory files are never opened with MPI access.
+     * @param fileName Name of the file. Only used if backingStore is set.
+     * @param incrementBytes Number of bytes by which the memory of the file
+     * grows each time more space is needed.
+     * @param backingStore If true, the file content is written to fileName
+     * when the file is closed or flushed.
+     * @throw PLI::HDF5::Exceptions::IdentifierNotValidException If the file
+     * couldn't be created or the file access token failed.
+     * @throw PLI::HDF5::Exceptions::HDF5RuntimeException Error during setting
+     * the core file driver.
+     */
+    void createInMemory(const std::string &fileName,
+                        const size_t incrementBytes = 1024 * 1024,
+                        const bool backingStore = false);
+    /**
+     * @brief Open a file from a file image.
+     *
+     * The image is copied and opened in memory with the core file driver.
+     * Images are created with PLI::HDF5::File::toImage, e.g. to send a small
+     * file to another process as a byte buffer. Changes of a file opened in
+     * read-write mode only affect the copy of the image.
+     * @param image Content of an HDF5 file.
+     * @param openState OpenState variable. Available values are
+     * PLI::HDF5::File::OpenState::ReadOnly and
+     * PLI::HDF5::File::OpenState::ReadWrite.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the image
+     * couldn't be opened or the file access token failed.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException Error during setting
+     * the file image.
+     */
+    void openImage(std::span<const std::byte> image,
+                   const OpenState openState = OpenState::ReadOnly);
+    /**
+     * @brief Get the content of the file as a file image.
+     *
+     * The file is flushed before the image is created. This works for files
+     * on disk and in memory, but not for files opened with MPI access.
+     * @return std::vector<std::byte> Content of the file.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the file
+     * pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the image could
+     * not be created.
+     */
+    std::vector<std::byte> toImage() const;
+
+    /**
+     * @brief Switch the file to single-writer / multiple-reader mode.
+     *
+     * Afterwards, other processes can open the file with
+     * PLI::HDF5::File::OpenState::SWMRRead and read the data while it is
+     * written. Existing datasets can be extended and written, but no new
+     * objects or attributes can be created. New data becomes visible to
+     * readers after PLI::HDF5::Dataset::flush or PLI::HDF5::File::flush,
+     * readers pick it up with PLI::HDF5::Dataset::refresh. The file has to be
+     * opened for writing without MPI access and created with
+     * PLI::HDF5::FileCreateOptions::swmr.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the file
+     * pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If SWMR mode could
+     * not be started, e.g. because of MPI access or an old file format.
+     */
+    void startSWMRWrite();
+    /**
+     * @brief Returns if the file is written or read in SWMR mode.
+     * @return true File was opened with PLI::HDF5::File::OpenState::SWMRRead or
+     * PLI::HDF5::File::startSWMRWrite was called.
+     * @return false File is accessed without SWMR.
+     */
+    bool usesSWMR() const;
 
     /**
      * @brief Check if the file is a valid HDF5 file.
@@ -169,6 +260,14 @@ class File : public Folder {
      */
     void flush();
 
+    /**
+     * @brief Wait until all asynchronous writes to this file are finished.
+     *
+     * Errors of the writes are reported by the PLI::HDF5::IOHandle returned
+     * by PLI::HDF5::Dataset::writeAsync. Closing the file waits as well.
+     */
+    void waitAll() const;
+
     /**
      * @brief Get the file access pointer.
      * @return hid_t File access pointer.
@@ -178,7 +277,9 @@ class File : public Folder {
     File &operator=(const PLI::HDF5::File &otherFile) noexcept;
 
   private:
-    hid_t createFaplID() const;
+    hid_t createFaplID(const std::optional<FileAccessOptions> &accessOptions,
+                       const bool pageBuffer) const;
+    static hid_t createFcplID(const FileCreateOptions &createOptions);
     hid_t m_faplID;
 };
 
@@ -190,6 +291,9 @@ class File : public Folder {
  * @param fileName File name.
  * @param communicator If an MPI_Comm is set, the file will be opened with MPI
  * access.
+ * @param accessOptions MPI-IO hints and file access tuning. If not set, the
+ * "file_access" section of the PLI::HDF5::Config file is used.
+ * @param createOptions File space strategy of the new file.
  * @return PLI::HDF5::File File object, if successful.
  * @throw PLI::HDF5::Exceptions::FileExistsException If the file already
  * exists.
@@ -200,7 +304,10 @@ class File : public Folder {
  */
 PLI::HDF5::File createFile(const std::string &fileName,
                            const PLI::HDF5::File::CreateState creationState,
-                           const std::optional<MPI_Comm> communicator = {});
+                           const std::optional<MPI_Comm> communicator = {},
+                           const std::optional<FileAccessOptions>
+                               &accessOptions = {},
+                           const FileCreateOptions &createOptions = {});
 
 /**
  * @brief Open an existing file object.
@@ -211,13 +318,19 @@ PLI::HDF5::File createFile(const std::string &fileName,
  * read-only mode or in read-write mode. Setting openState to
  * PLI::HDF5::File::OpenState::ReadOnly will open the file in read-only mode.
  * Setting openState to PLI::HDF5::File::OpenState::ReadWrite will open the
- * file in read-write mode.
+ * file in read-write mode. Setting openState to
+ * PLI::HDF5::File::OpenState::SWMRRead will open the file read-only while
+ * another process writes to it in SWMR mode.
  * @param fileName File name which will be opened.
  * @param openState OpenState variable. Available values are
- * PLI::HDF5::File::OpenState::ReadOnly and
- * PLI::HDF5::File::OpenState::ReadWrite.
+ * PLI::HDF5::File::OpenState::ReadOnly,
+ * PLI::HDF5::File::OpenState::ReadWrite and
+ * PLI::HDF5::File::OpenState::SWMRRead.
  * @param communicator If an MPI_Comm is set, the file will be opened with MPI
  * access.
+ * @param accessOptions MPI-IO hints and file access tuning. If not set, the
+ * "file_access" section of the PLI::HDF5::Config file is used. A page buffer
+ * is only used if the file was created with paged aggregation.
  * @return PLI::HDF5::File File object if successful.
  * @throws PLI::HDF5::Exceptions::FileNotFoundException If the file doesn't
  * exist.
@@ -230,6 +343,46 @@ PLI::HDF5::File createFile(const std::string &fileName,
  */
 PLI::HDF5::File openFile(const std::string &fileName,
                          const File::OpenState openState,
-                         const std::optional<MPI_Comm> communicator = {});
+                         const std::optional<MPI_Comm> communicator = {},
+                         const std::optional<FileAccessOptions> &accessOptions =
+                             {});
+
+/**
+ * @brief Create a new file object in memory.
+ *
+ * The file is created with the core file driver (H5FD_CORE) and kept
+ * completely in memory.
+ * @param fileName Name of the file. Only used if backingStore is set.
+ * @param incrementBytes Number of bytes by which the memory of the file grows
+ * each time more space is needed.
+ * @param backingStore If true, the file content is written to fileName when
+ * the file is closed or flushed.
+ * @return PLI::HDF5::File File object, if successful.
+ * @throw PLI::HDF5::Exceptions::IdentifierNotValidException If the file
+ * couldn't be created or the file access token failed.
+ * @throw PLI::HDF5::Exceptions::HDF5RuntimeException Error during setting the
+ * core file driver.
+ */
+PLI::HDF5::File createInMemoryFile(const std::string &fileName,
+                                   const size_t incrementBytes = 1024 * 1024,
+                                   const bool backingStore = false);
+
+/**
+ * @brief Open a file object from a file image.
+ *
+ * The image is copied and opened in memory with the core file driver.
+ * @param image Content of an HDF5 file, e.g. from PLI::HDF5::File::toImage.
+ * @param openState OpenState variable. Available values are
+ * PLI::HDF5::File::OpenState::ReadOnly and
+ * PLI::HDF5::File::OpenState::ReadWrite.
+ * @return PLI::HDF5::File File object if successful.
+ * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the image
+ * couldn't be opened or the file access token failed.
+ * @throws PLI::HDF5::Exceptions::HDF5RuntimeException Error during setting
+ * the file image.
+ */
+PLI::HDF5::File
+openFileImage(std::span<const std::byte> image,
+              const File::OpenState openState = File::OpenState::ReadOnly);
 } // namespace HDF5
 } // namespace PLI
@@ -0,0 +1,195 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <span>
+#include <string>
+#include <vector>
+
+#include "PLIHDF5/options.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Read-only memory mapping of a region of a file.
+ *
+ * The mapping is released when the object is destroyed.
+ */
+class MappedRegion {
+  public:
+    MappedRegion() noexcept = default;
+    MappedRegion(MappedRegion &&other) noexcept;
+    MappedRegion &operator=(MappedRegion &&other) noexcept;
+    MappedRegion(const MappedRegion &) = delete;
+    MappedRegion &operator=(const MappedRegion &) = delete;
+    ~MappedRegion();
+
+    /**
+     * @brief Map a region of a file.
+     *
+     * An existing mapping of this object is released first.
+     * @param fileName Path of the file.
+     * @param offset Offset of the region in bytes.
+     * @param length Length of the region in bytes.
+     * @param advice Expected access pattern.
+     * @return true The region is mapped.
+     * @return false The region could not be mapped, e.g. because memory
+     * mapping is not supported on this platform.
+     */
+    bool map(const std::string &fileName, size_t offset, size_t length,
+             MapAdvice advice) noexcept;
+    /**
+     * @brief Release the mapping.
+     */
+    void unmap() noexcept;
+    /**
+     * @brief Change the access hint of the mapping.
+     * @param advice Expected access pattern.
+     */
+    void advise(MapAdvice advice) const noexcept;
+
+    /**
+     * @brief Returns if a region is mapped.
+     * @return true A region is mapped.
+     */
+    bool isMapped() const noexcept;
+    /**
+     * @brief Returns the start of the mapped region.
+     * @return const void* Pointer to the first byte of the region or nullptr
+     * if nothing is mapped.
+     */
+    const void *data() const noexcept;
+    /**
+     * @brief Returns the length of the mapped region.
+     * @return size_t Length of the region in bytes.
+     */
+    size_t size() const noexcept;
+
+  private:
+    /// Start of the mapping, aligned to the page size.
+    void *m_mapping = nullptr;
+    /// Length of the mapping, including the bytes before the region.
+    size_t m_mappingLength = 0;
+    /// Offset of the region relative to the start of the mapping.
+    size_t m_regionOffset = 0;
+};
+
+/**
+ * @brief Read-only view of a complete dataset.
+ *
+ * The view is returned by Dataset::mapReadOnly. If the dataset could be
+ * memory-mapped, the elements are read directly from the page cache without
+ * a copy. Otherwise, the dataset was read with HDF5 into memory owned by the
+ * view. Both cases are accessed in the same way. The elements are stored in
+ * row-major order.
+ * @tparam T Type of the elements.
+ */
+template <typename T> class MappedView {
+  public:
+    /**
+     * @brief Construct a view of a memory-mapped dataset.
+     * @param region Mapping of the raw data of the dataset.
+     * @param dims Dimensions of the dataset.
+     */
+    MappedView(MappedRegion &&region, const std::vector<size_t> &dims);
+    /**
+     * @brief Construct a view of a dataset read into memory.
+     * @param data Elements of the dataset.
+     * @param dims Dimensions of the dataset.
+     */
+    MappedView(std::vector<T> &&data, const std::vector<size_t> &dims);
+    MappedView(MappedView &&other) noexcept;
+    MappedView &operator=(MappedView &&other) noexcept;
+    MappedView(const MappedView &) = delete;
+    MappedView &operator=(const MappedView &) = delete;
+
+    /**
+     * @brief Returns if the view is memory-mapped.
+     * @return true Elements are read from the mapped file.
+     * @return false Elements were read into memory with HDF5.
+     */
+    bool isMapped() const noexcept;
+    /**
+     * @brief Change the access hint. Does nothing if the view is not mapped.
+     * @param advice Expected access pattern.
+     */
+    void advise(MapAdvice advice) const noexcept;
+
+    /**
+     * @brief Returns the dimensions of the dataset.
+     * @return const std::vector<size_t>& Number of elements in each dimension.
+     */
+    const std::vector<size_t> &dims() const noexcept;
+    /**
+     * @brief Returns the number of elements.
+     * @return size_t Number of elements of the dataset.
+     */
+    size_t size() const noexcept;
+    /**
+     * @brief Returns a pointer to the first element.
+     * @return const T* First element.
+     */
+    const T *data() const noexcept;
+    /**
+     * @brief Returns all elements as span.
+     * @return std::span<const T> Elements in row-major order.
+     */
+    std::span<const T> span() const noexcept;
+    const T *begin() const noexcept;
+    const T *end() const noexcept;
+
+    /**
+     * @brief Access an element by its linear index.
+     * @param index Linear index in row-major order.
+     * @return const T& Element.
+     */
+    const T &operator[](size_t index) const noexcept;
+    /**
+     * @brief Access an element by its coordinates.
+     * @param coordinates Coordinates of the element in each dimension.
+     * @return const T& Element.
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the
+     * coordinates don't match the dimensions of the dataset.
+     */
+    const T &at(const std::vector<size_t> &coordinates) const;
+
+  private:
+    MappedRegion m_region;
+    std::vector<T> m_data;
+    std::vector<size_t> m_dims;
+    const T *m_pointer = nullptr;
+    size_t m_size = 0;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/mappedview.tpp"
@@ -0,0 +1,135 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include "PLIHDF5/mappedview.h"
+
+#include <functional>
+#include <numeric>
+
+#include "PLIHDF5/exceptions.h"
+
+template <typename T>
+PLI::HDF5::MappedView<T>::MappedView(MappedRegion &&region,
+                                     const std::vector<size_t> &dims)
+    : m_region(std::move(region)), m_dims(dims),
+      m_pointer(static_cast<const T *>(m_region.data())),
+      m_size(std::accumulate(dims.begin(), dims.end(), size_t{1},
+                             std::multiplies<size_t>())) {}
+
+template <typename T>
+PLI::HDF5::MappedView<T>::MappedView(std::vector<T> &&data,
+                                     const std::vector<size_t> &dims)
+    : m_data(std::move(data)), m_dims(dims), m_pointer(m_data.data()),
+      m_size(m_data.size()) {}
+
+template <typename T>
+PLI::HDF5::MappedView<T>::MappedView(MappedView &&other) noexcept
+    : m_region(std::move(other.m_region)), m_data(std::move(other.m_data)),
+      m_dims(std::move(other.m_dims)), m_pointer(other.m_pointer),
+      m_size(other.m_size) {
+    other.m_pointer = nullptr;
+    other.m_size = 0;
+}
+
+template <typename T>
+PLI::HDF5::MappedView<T> &
+PLI::HDF5::MappedView<T>::operator=(MappedView &&other) noexcept {
+    if (this != &other) {
+        m_region = std::move(other.m_region);
+        m_data = std::move(other.m_data);
+        m_dims = std::move(other.m_dims);
+        m_pointer = other.m_pointer;
+        m_size = other.m_size;
+        other.m_pointer = nullptr;
+        other.m_size = 0;
+    }
+    return *this;
+}
+
+template <typename T>
+bool PLI::HDF5::MappedView<T>::isMapped() const noexcept {
+    return m_region.isMapped();
+}
+
+template <typename T>
+void PLI::HDF5::MappedView<T>::advise(const MapAdvice advice) const noexcept {
+    m_region.advise(advice);
+}
+
+template <typename T>
+const std::vector<size_t> &PLI::HDF5::MappedView<T>::dims() const noexcept {
+    return m_dims;
+}
+
+template <typename T>
+size_t PLI::HDF5::MappedView<T>::size() const noexcept {
+    return m_size;
+}
+
+template <typename T>
+const T *PLI::HDF5::MappedView<T>::data() const noexcept {
+    return m_pointer;
+}
+
+template <typename T>
+std::span<const T> PLI::HDF5::MappedView<T>::span() const noexcept {
+    return std::span<const T>(m_pointer, m_size);
+}
+
+template <typename T>
+const T *PLI::HDF5::MappedView<T>::begin() const noexcept {
+    return m_pointer;
+}
+
+template <typename T>
+const T *PLI::HDF5::MappedView<T>::end() const noexcept {
+    return m_pointer + m_size;
+}
+
+template <typename T>
+const T &PLI::HDF5::MappedView<T>::operator[](const size_t index) const
+    noexcept {
+    return m_pointer[index];
+}
+
+template <typename T>
+const T &
+PLI::HDF5::MappedView<T>::at(const std::vector<size_t> &coordinates) const {
+    if (coordinates.size() != m_dims.size()) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "Coordinates must have the same size as dataset dimensions.");
+    }
+    size_t index = 0;
+    for (size_t i = 0; i < m_dims.size(); ++i) {
+        if (coordinates[i] >= m_dims[i]) {
+            throw PLI::HDF5::Exceptions::DimensionMismatchException(
+                "Coordinates exceed the dataset dimensions.");
+        }
+        index = index * m_dims[i] + coordinates[i];
+    }
+    return m_pointer[index];
+}
@@ -28,10 +28,12 @@
 #include <hdf5.h>
 #include <mpi.h>
 
+#include <initializer_list>
 #include <optional>
 #include <string>
 #include <vector>
 
+#include "PLIHDF5/options.h"
 #include "PLIHDF5/type.h"
 
 namespace PLI::HDF5 {
@@ -65,6 +67,23 @@ class Object {
      * @return MPI_Comm if one is set, else an empty optional.
      */
     std::optional<MPI_Comm> communicator() const noexcept;
+    /**
+     * @brief Returns the default MPI-IO transfer mode of the object.
+     * Like the communicator, the transfer mode is passed from a file or group
+     * to all datasets and groups opened or created through it afterwards.
+     * Datasets use it for every read / write call which does not set a
+     * transfer mode explicitly.
+     * @return PLI::HDF5::TransferMode Default transfer mode.
+     */
+    TransferMode transferMode() const noexcept;
+    /**
+     * @brief Set the default MPI-IO transfer mode of the object.
+     * Setting the transfer mode of a file or group does not change objects
+     * which were already opened through it. Without an MPI_Comm, the transfer
+     * mode is ignored.
+     * @param transferMode New default transfer mode.
+     */
+    void setTransferMode(const TransferMode transferMode) noexcept;
     /**
      * @brief Convert the dataset to a the raw HDF5 pointer.
      * @return hid_t Dataset ID stored in the object.
@@ -86,6 +105,7 @@ class Object {
                     const std::optional<MPI_Comm> &communicator = {}) noexcept;
 
     std::optional<MPI_Comm> m_communicator;
+    TransferMode m_transferMode;
     hid_t m_id;
 
     void closeFileObjects(unsigned int types);
@@ -123,13 +143,15 @@ class Folder : public Object {
      * This method tries to open an existing dataset with the given name. If the
      * dataset does not exist, an exception is thrown.
      * @param datasetName Name of the dataset to open.
+     * @param options Chunk cache options of the dataset.
      * @return PLI::HDF5::Dataset Dataset if successful.
      * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
      * or dataset pointer is invalid.
      * @throws PLI::HDF5::Exceptions::DatasetNotFoundException If the dataset
      * does not exist.
      */
-    Dataset openDataset(const std::string &datasetName);
+    Dataset openDataset(const std::string &datasetName,
+                        const DatasetAccessOptions &options = {});
     /**
      * @brief Create a new dataset with the given name.
      *
@@ -157,6 +179,26 @@ class Folder : public Object {
                           const std::vector<size_t> &dims,
                           const std::vector<size_t> &chunkDims = {});
 
+    /**
+     * @brief Create a new dataset with the given name.
+     *
+     * Same as the method above for braced chunk dimensions, e.g. {} or
+     * {64, 64}. This overload keeps such calls unambiguous with the overload
+     * taking PLI::HDF5::DatasetCreateOptions.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param chunkDims Chunking dimensions of the dataset. If empty, the
+     * chunking is disabled.
+     * @return PLI::HDF5::Dataset New dataset object if successful.
+     */
+    template <typename T>
+    Dataset createDataset(const std::string &datasetName,
+                          const std::vector<size_t> &dims,
+                          std::initializer_list<size_t> chunkDims);
+
     /**
      * @brief Create a new dataset with the given name.
      *
@@ -182,6 +224,78 @@ class Folder : public Object {
         const std::vector<size_t> &chunkDims = {},
         const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
 
+    /**
+     * @brief Create a new dataset with the given name.
+     *
+     * Same as the method above for braced chunk dimensions, e.g. {} or
+     * {64, 64}. This overload keeps such calls unambiguous with the overload
+     * taking PLI::HDF5::DatasetCreateOptions.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param chunkDims Chunking dimensions of the dataset. If empty, the
+     * chunking is disabled.
+     * @param dataType Datatype of the dataset. Default = float.
+     * @return PLI::HDF5::Dataset New dataset object if successful.
+     */
+    Dataset createDataset(
+        const std::string &datasetName, const std::vector<size_t> &dims,
+        std::initializer_list<size_t> chunkDims,
+        const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
+
+    /**
+     * @brief Create a new dataset with the given name and options.
+     *
+     * This method tries to create a new dataset with the given name. If the
+     * dataset already exists, an exception is thrown.
+     * Besides the chunk dimensions, the options configure the shuffle,
+     * compression and checksum filters of the dataset.
+     * @tparam T Supported data types are: bool, char, unsigned char, short,
+     * unsigned short, int, unsigned int, long, unsigned long, long long,
+     * unsigned long long, float, double, long double.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param options Chunking and filter options of the dataset.
+     * @return PLI::HDF5::Dataset New dataset object if successful.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
+     * or dataset pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::DatasetExistsException If the dataset
+     * already exists.
+     * @throws PLI::HDF5::Exceptions::FilterNotAvailableException If a
+     * requested filter is not available.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be created.
+     */
+    template <typename T>
+    Dataset createDataset(const std::string &datasetName,
+                          const std::vector<size_t> &dims,
+                          const DatasetCreateOptions &options);
+
+    /**
+     * @brief Create a new dataset with the given name and options.
+     *
+     * This method tries to create a new dataset with the given name. If the
+     * dataset already exists, an exception is thrown.
+     * Besides the chunk dimensions, the options configure the shuffle,
+     * compression and checksum filters of the dataset.
+     * @param datasetName Name of the dataset to create.
+     * @param dims Dimensions of the new dataset.
+     * @param options Chunking and filter options of the dataset.
+     * @param dataType Datatype of the dataset. Default = float.
+     * @return PLI::HDF5::Dataset New dataset object if successful.
+     * @throws PLI::HDF5::Exceptions::IdentifierNotValidException If the parent
+     * or dataset pointer is invalid.
+     * @throws PLI::HDF5::Exceptions::DatasetExistsException If the dataset
+     * already exists.
+     * @throws PLI::HDF5::Exceptions::FilterNotAvailableException If a
+     * requested filter is not available.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the dataset could
+     * not be created.
+     */
+    Dataset createDataset(
+        const std::string &datasetName, const std::vector<size_t> &dims,
+        const DatasetCreateOptions &options,
+        const PLI::HDF5::Type &dataType = PLI::HDF5::Type::createType<float>());
+
   protected:
     explicit Folder(const std::optional<MPI_Comm> &communicator = {}) noexcept;
     explicit Folder(const hid_t id,
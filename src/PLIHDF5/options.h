@@ -0,0 +1,330 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <map>
+#include <optional>
+#include <string>
+#include <vector>
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Maximum dimension of a dataset which can be extended without limit.
+ */
+constexpr size_t UNLIMITED = static_cast<size_t>(-1);
+
+/**
+ * @brief MPI-IO transfer mode used for reading and writing datasets.
+ *
+ * The transfer mode only has an effect if the file was opened with an
+ * MPI_Comm. In collective mode, every process of the communicator has to take
+ * part in each read / write call, even if its selection is empty. In return,
+ * HDF5 can aggregate the requests of all processes (two-phase I/O) instead of
+ * issuing many small requests per process.
+ */
+enum class TransferMode {
+    /// Each process reads / writes on its own (H5FD_MPIO_INDEPENDENT).
+    Independent = 0,
+    /// All processes read / write together (H5FD_MPIO_COLLECTIVE).
+    Collective = 1,
+    /// Collective I/O, performing one linked I/O call for all chunks
+    /// (H5FD_MPIO_CHUNK_ONE_IO).
+    CollectiveLinkedChunks = 2,
+    /// Collective I/O, deciding per chunk whether collective or independent
+    /// I/O is used (H5FD_MPIO_CHUNK_MULTI_IO).
+    CollectiveMultiChunk = 3
+};
+
+/**
+ * @brief Shuffle filter applied before compressing a chunk.
+ *
+ * Shuffling regroups the bytes (or bits) of all values in a chunk so that
+ * the slowly changing parts of neighbouring values are stored next to each
+ * other. For smooth images this considerably improves the compression ratio.
+ */
+enum class Shuffle {
+    /// No shuffle filter.
+    None = 0,
+    /// Byte shuffle (built into HDF5).
+    Byte = 1,
+    /// Bit shuffle (HDF5 plugin, filter ID 32008).
+    Bit = 2
+};
+
+/**
+ * @brief Compression filter applied to each chunk of a dataset.
+ *
+ * Filters marked as plugin are loaded dynamically by HDF5 from the paths in
+ * HDF5_PLUGIN_PATH. Use PLI::HDF5::Dataset::filterAvailable to check at
+ * runtime if a filter can be used.
+ */
+enum class Compression {
+    /// No compression.
+    None = 0,
+    /// Deflate / gzip (built into HDF5). Level 0-9, default 4.
+    Deflate = 1,
+    /// SZIP (built into HDF5 if enabled). Level = pixels per block (even, at
+    /// most 32), default 16.
+    SZip = 2,
+    /// Zstandard (HDF5 plugin, filter ID 32015). Level 1-22, default 3.
+    Zstd = 3,
+    /// LZ4 (HDF5 plugin, filter ID 32004). Level = block size in bytes,
+    /// default 0 (1 GiB blocks).
+    LZ4 = 4
+};
+
+/**
+ * @brief Expected access pattern of a dataset.
+ *
+ * The access pattern is used to size the chunk cache automatically.
+ */
+enum class AccessPattern {
+    /// Complete rows along the first dimension are read one after another.
+    /// All chunks crossed by a row are kept in the cache, so each chunk is
+    /// read and decompressed only once per sweep.
+    RowSweep = 0,
+    /// Tiles smaller than or as large as a chunk are read one after another.
+    /// The chunks which can be touched by a single tile are kept in the cache.
+    TileSweep = 1
+};
+
+/**
+ * @brief Options used when opening or creating a dataset.
+ *
+ * Configures the chunk cache of a dataset. Values which are not set are
+ * either derived from the access pattern or the HDF5 defaults are used.
+ */
+struct DatasetAccessOptions {
+    /// Size of the chunk cache in bytes. HDF5 default = 1 MiB.
+    std::optional<size_t> cacheBytes = {};
+    /// Number of hash table slots of the chunk cache. Should be a prime
+    /// number about 100 times larger than the number of cached chunks.
+    std::optional<size_t> cacheSlots = {};
+    /// Preemption policy between 0 and 1. With 1, chunks which were read
+    /// completely are evicted first. HDF5 default = 0.75.
+    std::optional<double> preemption = {};
+    /// Size the cache automatically from the chunk dimensions and the
+    /// datatype of the dataset. Explicitly set values take precedence.
+    std::optional<AccessPattern> accessPattern = {};
+};
+
+/**
+ * @brief Access profile used to choose chunk dimensions automatically.
+ *
+ * The first two dimensions of a dataset are treated as the image plane, all
+ * further dimensions (channels, z) as depth.
+ */
+enum class ChunkProfile {
+    /// Square tiles in the image plane with a depth of one, e.g. for tile
+    /// viewers.
+    Tile = 0,
+    /// Full width rows of the image plane with a depth of one, e.g. for
+    /// line-wise processing.
+    RowScan = 1,
+    /// Complete depth for a small square area of the image plane, e.g. for
+    /// reading z-stacks or all channels of a pixel.
+    ZColumn = 2
+};
+
+/**
+ * @brief Policy used to choose chunk dimensions automatically.
+ */
+struct ChunkPolicy {
+    /// Access profile of the dataset.
+    ChunkProfile profile = ChunkProfile::Tile;
+    /// Size of a chunk in bytes the chosen dimensions should approach. Chunks
+    /// can be smaller if the dataset is smaller.
+    size_t targetBytes = 1024 * 1024;
+};
+
+/**
+ * @brief Options used when creating a new dataset.
+ *
+ * Filters can only be applied to chunked datasets. Writing to a filtered
+ * dataset in parallel requires a collective transfer mode.
+ */
+struct DatasetCreateOptions {
+    /// Chunking dimensions of the dataset. If empty, chunking is disabled
+    /// unless a chunk policy is set.
+    std::vector<size_t> chunkDims;
+    /// Choose the chunk dimensions automatically if chunkDims is empty.
+    std::optional<ChunkPolicy> chunkPolicy = {};
+    /// Maximum dimensions of the dataset. Use PLI::HDF5::UNLIMITED for
+    /// dimensions without limit. If empty, the dataset cannot be extended.
+    /// Extendible datasets have to be chunked.
+    std::vector<size_t> maxDims;
+    /// Shuffle filter applied before the compression.
+    Shuffle shuffle = Shuffle::None;
+    /// Compression filter.
+    Compression compression = Compression::None;
+    /// Level of the compression filter. If not set, the default level of the
+    /// filter is used.
+    std::optional<unsigned> compressionLevel = {};
+    /// Store a Fletcher32 checksum for each chunk.
+    bool fletcher32 = false;
+    /// Chunk cache of the created dataset.
+    DatasetAccessOptions access = {};
+};
+
+/**
+ * @brief Access hint for memory-mapped datasets, passed to madvise.
+ */
+enum class MapAdvice {
+    /// No special treatment (MADV_NORMAL).
+    Normal = 0,
+    /// Pages are accessed in random order, e.g. single tiles (MADV_RANDOM).
+    Random = 1,
+    /// Pages are accessed one after another (MADV_SEQUENTIAL).
+    Sequential = 2,
+    /// The whole dataset will be accessed soon (MADV_WILLNEED).
+    WillNeed = 3
+};
+
+/**
+ * @brief Handling of the caller's buffer by asynchronous writes.
+ */
+enum class AsyncBuffer {
+    /// The data is copied. The caller can reuse its buffer immediately.
+    Copy = 0,
+    /// The data is written from the caller's buffer. The buffer has to stay
+    /// valid and unchanged until the write is finished.
+    Borrow = 1
+};
+
+/**
+ * @brief Values of the halo of a tile outside of the dataset, see
+ * PLI::HDF5::Dataset::readWithHalo.
+ */
+enum class BoundaryMode {
+    /// Repeat the value at the border of the dataset (aaa|abcd|ddd).
+    Clamp = 0,
+    /// Mirror the dataset at its border without repeating the border value
+    /// (dcb|abcd|cba).
+    Mirror = 1,
+    /// Fill with a constant value.
+    Constant = 2
+};
+
+/**
+ * @brief Distribution of the chunks of a dataset to the processes of an MPI
+ * job, see PLI::HDF5::ChunkScheduler.
+ */
+enum class ChunkSchedule {
+    /// Each process gets one contiguous block of chunks in row-major order.
+    Static = 0,
+    /// Each process gets one contiguous segment of chunks along a Hilbert
+    /// curve, i.e. a compact region of the image.
+    Hilbert = 1,
+    /// Processes take the next chunk along the Hilbert curve from a shared
+    /// counter (MPI one-sided communication) when they are done with their
+    /// last one.
+    WorkStealing = 2
+};
+
+/**
+ * @brief Options of PLI::HDF5::ChunkScheduler.
+ */
+struct ChunkScheduleOptions {
+    /// Distribution of the chunks.
+    ChunkSchedule schedule = ChunkSchedule::Hilbert;
+    /// Balance the static schedules by the stored (compressed) size of the
+    /// chunks instead of their number. Chunks showing mostly background
+    /// compress well and are cheap to process.
+    bool weightByStoredSize = true;
+    /// Skip chunks which were never written. Reading them only returns the
+    /// fill value of the dataset.
+    bool skipUnallocated = false;
+};
+
+/**
+ * @brief Options used when creating or opening a file.
+ *
+ * Tunes the file access property list of a file. Values which are not set
+ * keep the HDF5 / MPI-IO defaults. MPI hints and the collective metadata
+ * flags only have an effect if the file is opened with an MPI_Comm.
+ */
+struct FileAccessOptions {
+    /// MPI-IO hints passed as MPI_Info to the MPI-IO driver, e.g.
+    /// striping_factor, striping_unit, cb_nodes or romio_cb_write.
+    std::map<std::string, std::string> mpiHints;
+    /// Perform all metadata reads collectively
+    /// (H5Pset_all_coll_metadata_ops).
+    std::optional<bool> collectiveMetadataReads = {};
+    /// Write metadata collectively when flushing the metadata cache
+    /// (H5Pset_coll_metadata_write).
+    std::optional<bool> collectiveMetadataWrites = {};
+    /// Objects of at least this size in bytes are aligned in the file.
+    /// Defaults to 1 (align every object) if only alignment is set.
+    std::optional<size_t> alignmentThreshold = {};
+    /// Alignment of objects in the file in bytes, e.g. the stripe size of
+    /// a parallel file system.
+    std::optional<size_t> alignment = {};
+    /// Minimum size in bytes of the blocks allocated for metadata. HDF5
+    /// default = 2 KiB.
+    std::optional<size_t> metadataBlockSize = {};
+    /// Size of the page buffer in bytes. Has to be a multiple of the page
+    /// size of the file. Only used for files created with paged aggregation
+    /// and without an MPI_Comm, other files are opened without page buffer.
+    std::optional<size_t> pageBufferSize = {};
+    /// Percentage of the page buffer reserved for metadata pages.
+    unsigned pageBufferMinMetadataPercent = 0;
+    /// Percentage of the page buffer reserved for raw data pages.
+    unsigned pageBufferMinRawDataPercent = 0;
+};
+
+/**
+ * @brief Options used when creating a new file.
+ *
+ * With paged aggregation, HDF5 allocates the file space in fixed-size pages
+ * and keeps metadata and raw data in separate pages. The small metadata
+ * objects of a file (groups, attributes, dataset headers) are then packed
+ * into few pages which can be read with a few large requests, especially
+ * together with a page buffer (FileAccessOptions::pageBufferSize).
+ */
+struct FileCreateOptions {
+    /// Use the paged aggregation file space strategy
+    /// (H5F_FSPACE_STRATEGY_PAGE).
+    bool pagedAggregation = false;
+    /// Size of a file space page in bytes. HDF5 default = 4 KiB.
+    std::optional<size_t> pageSize = {};
+    /// Track free space across closing and reopening the file, so space of
+    /// deleted objects can be reused.
+    bool persistFreeSpace = false;
+    /// Create the file with the latest file format, which is required for
+    /// single-writer / multiple-reader access
+    /// (PLI::HDF5::File::startSWMRWrite). Such files cannot be read with HDF5
+    /// versions before 1.10.
+    bool swmr = false;
+};
+} // namespace HDF5
+} // namespace PLI
@@ -25,13 +25,19 @@
 
 #pragma once
 
+#include "PLIHDF5/asyncio.h"
 #include "PLIHDF5/attributes.h"
+#include "PLIHDF5/bufferedwriter.h"
+#include "PLIHDF5/chunkscheduler.h"
 #include "PLIHDF5/config.h"
 #include "PLIHDF5/dataset.h"
+#include "PLIHDF5/datasetgroupio.h"
 #include "PLIHDF5/exceptions.h"
 #include "PLIHDF5/file.h"
 #include "PLIHDF5/group.h"
 #include "PLIHDF5/link.h"
+#include "PLIHDF5/mappedview.h"
 #include "PLIHDF5/plim.h"
+#include "PLIHDF5/pyramid.h"
 #include "PLIHDF5/sha512.h"
 #include "PLIHDF5/type.h"
@@ -0,0 +1,187 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <array>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/group.h"
+#include "PLIHDF5/options.h"
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Reduction applied to each 2x2 (or 2x2x2) block of a pyramid level.
+ */
+enum class PyramidKernel {
+    /// Mean value of the block. Integer types are rounded.
+    Mean = 0,
+    /// Maximum value of the block.
+    Max = 1,
+    /// First value of the block.
+    Nearest = 2
+};
+
+/**
+ * @brief Options used when building an image pyramid.
+ */
+struct PyramidOptions {
+    /// Reduction of each block.
+    PyramidKernel kernel = PyramidKernel::Mean;
+    /// Number of reduced levels. If zero, levels are added until the image
+    /// plane fits into minSize x minSize.
+    size_t levels = 0;
+    /// Size of the smallest level if the number of levels is chosen
+    /// automatically.
+    size_t minSize = 256;
+    /// Also halve the third dimension (2x2x2 blocks) instead of keeping it,
+    /// e.g. for volumes instead of channels.
+    bool reduceDepth = false;
+    /// Number of threads per process. If zero, all hardware threads are used.
+    unsigned numThreads = 0;
+    /// Options of the created level datasets. If no chunk dimensions are
+    /// given, the chunk dimensions are chosen for tile access.
+    DatasetCreateOptions datasetOptions = {};
+};
+
+/**
+ * @brief Builder for multi-resolution image pyramids.
+ *
+ * The pyramid is stored as datasets named "00", "01", ... in a group. Level
+ * "00" is the source dataset, each following level halves the image plane of
+ * its parent. The source is read once in bands of rows. Each band is reduced
+ * in memory level by level, so no level is read back from disk. With MPI, the
+ * bands are distributed among the processes and all processes of the
+ * communicator have to call build.
+ */
+class Pyramid {
+  public:
+    /**
+     * @brief Construct a new Pyramid builder.
+     * @param options Options of the pyramid.
+     */
+    explicit Pyramid(const PyramidOptions &options = {}) noexcept;
+
+    /**
+     * @brief Build the pyramid of a dataset.
+     *
+     * Level "00" is a hard link to the source dataset if it is stored in the
+     * same file as the group, otherwise it is a copy.
+     * @tparam T Datatype used for the reduction. Supported data types are:
+     * char, unsigned char, short, unsigned short, int, unsigned int, long,
+     * unsigned long, long long, unsigned long long, float, double, long double.
+     * @param source Dataset with two or more dimensions.
+     * @param group Group in which the levels are stored.
+     * @return std::vector<Dataset> Datasets of all levels, starting with "00".
+     * @throws PLI::HDF5::Exceptions::DimensionMismatchException If the source
+     * has less than two dimensions or less than three dimensions when
+     * reducing the depth.
+     * @throws PLI::HDF5::Exceptions::DatasetExistsException If a level already
+     * exists in the group.
+     * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If a level could not
+     * be created or written.
+     */
+    template <typename T>
+    std::vector<Dataset> build(const Dataset &source, Group &group) const;
+
+    /**
+     * @brief Reduce a block of data by a factor of two.
+     *
+     * The first two dimensions are halved, the third dimension only if depth
+     * reduction is enabled. All further dimensions are kept. Odd dimensions
+     * are rounded up, the last block then contains fewer elements.
+     * @tparam T Datatype of the data.
+     * @param data Data in row-major order.
+     * @param dims Dimensions of the data.
+     * @return std::vector<T> Reduced data with the dimensions of
+     * levelDims(dims, 1, reduceDepth).
+     */
+    template <typename T>
+    std::vector<T> reduce(const std::vector<T> &data,
+                          const std::vector<size_t> &dims) const;
+
+    /**
+     * @brief Returns the number of reduced levels needed until the image plane
+     * fits into minSize x minSize.
+     * @param dims Dimensions of the source.
+     * @param minSize Maximum size of the image plane of the last level.
+     * @return size_t Number of levels without level "00".
+     */
+    static size_t numLevels(const std::vector<size_t> &dims,
+                            const size_t minSize);
+
+    /**
+     * @brief Returns the dimensions of a pyramid level.
+     * @param dims Dimensions of the source.
+     * @param level Level, 0 being the source.
+     * @param reduceDepth Also halve the third dimension.
+     * @return std::vector<size_t> Dimensions of the level.
+     */
+    static std::vector<size_t> levelDims(const std::vector<size_t> &dims,
+                                         const size_t level,
+                                         const bool reduceDepth = false);
+
+    /**
+     * @brief Returns the name of a pyramid level, e.g. "01".
+     * @param level Level, 0 being the source.
+     * @return std::string Name of the dataset of the level.
+     */
+    static std::string levelName(const size_t level);
+
+  private:
+    /// Type used to sum the values of a block. Integers are summed exactly.
+    template <typename T>
+    using Sum = std::conditional_t<
+        std::is_floating_point_v<T>, T,
+        std::conditional_t<std::is_signed_v<T>, long long,
+                           unsigned long long>>;
+
+    template <typename T> static T mean(const Sum<T> sum, const size_t count);
+    template <PyramidKernel Kernel, typename T, size_t N>
+    static void reduceBlocks(const T *data, const size_t step, T *result,
+                             const size_t count,
+                             const std::array<size_t, N> &offsets);
+
+    Dataset createLevel(const Dataset &source, Group &group,
+                        const size_t level, const PLI::HDF5::Type &type) const;
+    static Dataset linkSource(const Dataset &source, Group &group);
+    unsigned numThreads() const noexcept;
+
+    PyramidOptions m_options;
+};
+} // namespace HDF5
+} // namespace PLI
+
+#include "PLIHDF5/pyramid.tpp"
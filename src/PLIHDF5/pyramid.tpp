@@ -0,0 +1,310 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+#pragma once
+
+#include <mpi.h>
+
+#include <algorithm>
+#include <array>
+#include <functional>
+#include <future>
+#include <numeric>
+#include <type_traits>
+
+#include "PLIHDF5/exceptions.h"
+#include "PLIHDF5/pyramid.h"
+
+template <typename T>
+std::vector<PLI::HDF5::Dataset>
+PLI::HDF5::Pyramid::build(const Dataset &source, Group &group) const {
+    const std::vector<size_t> dims = source.dims();
+    if (dims.size() < 2 || (m_options.reduceDepth && dims.size() < 3)) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "PLI::HDF5::Pyramid::build: Source has not enough dimensions.");
+    }
+    const size_t levels = m_options.levels > 0
+                              ? m_options.levels
+                              : numLevels(dims, m_options.minSize);
+
+    std::vector<Dataset> pyramid;
+    pyramid.push_back(linkSource(source, group));
+    const PLI::HDF5::Type dataType = source.type();
+    for (size_t level = 1; level <= levels; ++level) {
+        pyramid.push_back(createLevel(source, group, level, dataType));
+    }
+    checkHDF5Call(H5Tclose(dataType), "H5Tclose");
+    if (levels == 0) {
+        return pyramid;
+    }
+
+    // Each band of rows reduces to whole rows in every level. Bands follow
+    // the chunks of the source, so that each chunk is only read once.
+    const size_t bandUnit = size_t{1} << levels;
+    size_t bandRows = source.isChunked() ? source.chunkDims()[0] : 1;
+    bandRows = (std::max(bandRows, bandUnit) + bandUnit - 1) / bandUnit *
+               bandUnit;
+    const size_t numBands = (dims[0] + bandRows - 1) / bandRows;
+
+    int rank = 0;
+    int size = 1;
+    if (source.communicator().has_value()) {
+        MPI_Comm_rank(source.communicator().value(), &rank);
+        MPI_Comm_size(source.communicator().value(), &size);
+    }
+
+    // Every process takes part in the same number of calls, so that
+    // collective transfer modes can be used.
+    const std::vector<size_t> emptySelection(dims.size(), 0);
+    const size_t rounds = (numBands + size - 1) / size;
+    for (size_t round = 0; round < rounds; ++round) {
+        const size_t band = round * size + rank;
+        if (band >= numBands) {
+            source.read<T>(emptySelection, emptySelection);
+            for (size_t level = 1; level <= levels; ++level) {
+                pyramid[level].write(std::vector<T>(), emptySelection,
+                                     emptySelection);
+            }
+            continue;
+        }
+
+        std::vector<size_t> offset(dims.size(), 0);
+        std::vector<size_t> count = dims;
+        offset[0] = band * bandRows;
+        count[0] = std::min(bandRows, dims[0] - offset[0]);
+        std::vector<T> data = source.read<T>(offset, count);
+        for (size_t level = 1; level <= levels; ++level) {
+            data = reduce(data, count);
+            offset[0] /= 2;
+            count = levelDims(count, 1, m_options.reduceDepth);
+            pyramid[level].write(data, offset, count);
+        }
+    }
+    return pyramid;
+}
+
+template <typename T>
+std::vector<T>
+PLI::HDF5::Pyramid::reduce(const std::vector<T> &data,
+                           const std::vector<size_t> &dims) const {
+    if (dims.size() < 2 || (m_options.reduceDepth && dims.size() < 3)) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "PLI::HDF5::Pyramid::reduce: Data has not enough dimensions.");
+    }
+    if (data.size() != std::accumulate(dims.begin(), dims.end(), size_t{1},
+                                       std::multiplies<size_t>())) {
+        throw PLI::HDF5::Exceptions::DimensionMismatchException(
+            "PLI::HDF5::Pyramid::reduce: Data does not match dimensions.");
+    }
+
+    const std::vector<size_t> outDims =
+        levelDims(dims, 1, m_options.reduceDepth);
+    const size_t rows = dims[0];
+    const size_t cols = dims[1];
+    const size_t depth = dims.size() > 2 ? dims[2] : 1;
+    const size_t inner =
+        dims.size() > 3 ? std::accumulate(dims.begin() + 3, dims.end(),
+                                          size_t{1}, std::multiplies<size_t>())
+                        : 1;
+    const size_t outCols = outDims[1];
+    const size_t outDepth = dims.size() > 2 ? outDims[2] : 1;
+    const size_t depthFactor = m_options.reduceDepth ? 2 : 1;
+
+    const size_t depthStride = inner;
+    const size_t colStride = depth * depthStride;
+    const size_t rowStride = cols * colStride;
+    std::vector<T> result(std::accumulate(outDims.begin(), outDims.end(),
+                                          size_t{1},
+                                          std::multiplies<size_t>()));
+
+    // Reduces the output block (r, c, z). Only used for partial blocks at
+    // the borders of the data, full blocks are reduced by reduceBlocks.
+    auto reduceEdge = [&](auto kernel, const size_t r, const size_t c,
+                          const size_t z) {
+        constexpr PyramidKernel Kernel = decltype(kernel)::value;
+        const size_t numRows = std::min<size_t>(2, rows - 2 * r);
+        const size_t numCols = std::min<size_t>(2, cols - 2 * c);
+        const size_t numDepth = std::min(depthFactor, depth - depthFactor * z);
+        const T *block = data.data() + 2 * r * rowStride + 2 * c * colStride +
+                         depthFactor * z * depthStride;
+        T *out = result.data() + ((r * outCols + c) * outDepth + z) * inner;
+        if constexpr (Kernel == PyramidKernel::Nearest) {
+            std::copy_n(block, inner, out);
+            return;
+        }
+        for (size_t k = 0; k < inner; ++k) {
+            Sum<T> sum = 0;
+            T maximum = block[k];
+            for (size_t dr = 0; dr < numRows; ++dr) {
+                for (size_t dc = 0; dc < numCols; ++dc) {
+                    for (size_t dz = 0; dz < numDepth; ++dz) {
+                        const T value = block[k + dr * rowStride +
+                                              dc * colStride +
+                                              dz * depthStride];
+                        sum += static_cast<Sum<T>>(value);
+                        maximum = std::max(maximum, value);
+                    }
+                }
+            }
+            if constexpr (Kernel == PyramidKernel::Max) {
+                out[k] = maximum;
+            } else {
+                out[k] = mean<T>(sum, numRows * numCols * numDepth);
+            }
+        }
+    };
+
+    auto reduceRowsWith = [&](auto kernel, const size_t begin,
+                              const size_t end) {
+        constexpr PyramidKernel Kernel = decltype(kernel)::value;
+        for (size_t r = begin; r < end; ++r) {
+            const T *inRow = data.data() + 2 * r * rowStride;
+            T *outRow = result.data() + r * outCols * outDepth * inner;
+            // Full blocks are only possible if the row has a second row.
+            const size_t fullCols = 2 * r + 1 < rows ? cols / 2 : 0;
+            if (fullCols > 0 && depthFactor == 1 && colStride == 1) {
+                // One value per pixel, reduce the whole row at once.
+                reduceBlocks<Kernel, T, 4>(inRow, 2, outRow, fullCols,
+                                           {0, 1, rowStride, rowStride + 1});
+            } else if (fullCols > 0 && depthFactor == 1) {
+                // The values of a pixel are contiguous in input and output.
+                const std::array<size_t, 4> offsets{
+                    0, colStride, rowStride, rowStride + colStride};
+                for (size_t c = 0; c < fullCols; ++c) {
+                    reduceBlocks<Kernel>(inRow + 2 * c * colStride, 1,
+                                         outRow + c * colStride, colStride,
+                                         offsets);
+                }
+            } else if (fullCols > 0) {
+                const std::array<size_t, 8> offsets{
+                    0,
+                    depthStride,
+                    colStride,
+                    colStride + depthStride,
+                    rowStride,
+                    rowStride + depthStride,
+                    rowStride + colStride,
+                    rowStride + colStride + depthStride};
+                const size_t fullDepth = depth / 2;
+                for (size_t c = 0; c < fullCols; ++c) {
+                    for (size_t z = 0; z < fullDepth; ++z) {
+                        reduceBlocks<Kernel>(
+                            inRow + 2 * c * colStride + 2 * z * depthStride,
+                            1, outRow + (c * outDepth + z) * inner, inner,
+                            offsets);
+                    }
+                    for (size_t z = fullDepth; z < outDepth; ++z) {
+                        reduceEdge(kernel, r, c, z);
+                    }
+                }
+            }
+            for (size_t c = fullCols; c < outCols; ++c) {
+                for (size_t z = 0; z < outDepth; ++z) {
+                    reduceEdge(kernel, r, c, z);
+                }
+            }
+        }
+    };
+
+    // Select the kernel once, so that the loops are compiled for each kernel.
+    auto reduceRows = [&](const size_t begin, const size_t end) {
+        switch (m_options.kernel) {
+        case PyramidKernel::Max:
+            reduceRowsWith(std::integral_constant<PyramidKernel,
+                                                  PyramidKernel::Max>(),
+                           begin, end);
+            break;
+        case PyramidKernel::Nearest:
+            reduceRowsWith(std::integral_constant<PyramidKernel,
+                                                  PyramidKernel::Nearest>(),
+                           begin, end);
+            break;
+        default:
+            reduceRowsWith(std::integral_constant<PyramidKernel,
+                                                  PyramidKernel::Mean>(),
+                           begin, end);
+            break;
+        }
+    };
+
+    // Split the output rows among the threads. The calling thread handles
+    // the first part.
+    const size_t outRows = outDims[0];
+    const size_t numParts =
+        std::max<size_t>(1, std::min<size_t>(numThreads(), outRows));
+    const size_t partRows = (outRows + numParts - 1) / numParts;
+    std::vector<std::future<void>> parts;
+    for (size_t part = 1; part < numParts; ++part) {
+        const size_t begin = std::min(outRows, part * partRows);
+        const size_t end = std::min(outRows, begin + partRows);
+        parts.push_back(
+            std::async(std::launch::async, reduceRows, begin, end));
+    }
+    reduceRows(0, std::min(outRows, partRows));
+    for (auto &part : parts) {
+        part.get();
+    }
+    return result;
+}
+
+template <typename T>
+T PLI::HDF5::Pyramid::mean(const Sum<T> sum, const size_t count) {
+    const Sum<T> numValues = static_cast<Sum<T>>(count);
+    if constexpr (std::is_floating_point_v<T>) {
+        return sum / numValues;
+    } else if constexpr (std::is_signed_v<T>) {
+        // Round half away from zero like std::round.
+        return static_cast<T>(
+            (sum >= 0 ? sum + numValues / 2 : sum - numValues / 2) /
+            numValues);
+    } else {
+        return static_cast<T>((sum + numValues / 2) / numValues);
+    }
+}
+
+template <PLI::HDF5::PyramidKernel Kernel, typename T, size_t N>
+void PLI::HDF5::Pyramid::reduceBlocks(const T *data, const size_t step,
+                                      T *result, const size_t count,
+                                      const std::array<size_t, N> &offsets) {
+    // The number of values per block is fixed, so the compiler can unroll
+    // the reduction and vectorize the loop over the blocks.
+    for (size_t i = 0; i < count; ++i) {
+        const T *block = data + i * step;
+        if constexpr (Kernel == PyramidKernel::Nearest) {
+            result[i] = block[0];
+        } else if constexpr (Kernel == PyramidKernel::Max) {
+            T maximum = block[0];
+            for (size_t j = 1; j < N; ++j) {
+                maximum = std::max(maximum, block[offsets[j]]);
+            }
+            result[i] = maximum;
+        } else {
+            Sum<T> sum = 0;
+            for (size_t j = 0; j < N; ++j) {
+                sum += static_cast<Sum<T>>(block[offsets[j]]);
+            }
+            result[i] = mean<T>(sum, N);
+        }
+    }
+}
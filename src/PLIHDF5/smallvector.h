@@ -0,0 +1,211 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cstddef>
+#include <initializer_list>
+#include <vector>
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Vector which stores up to N elements inline.
+ *
+ * Hyperslabs of image data almost always have two to four dimensions. Keeping
+ * their extents inline avoids a heap allocation for every hyperslab. Larger
+ * vectors fall back to a std::vector. The elements are always stored
+ * contiguously, so data() can be passed to the HDF5 C API directly.
+ * @tparam T Type of the elements.
+ * @tparam N Number of elements stored inline.
+ */
+template <typename T, size_t N> class SmallVector {
+  public:
+    using value_type = T;
+    using size_type = size_t;
+    using difference_type = std::ptrdiff_t;
+    using reference = T &;
+    using const_reference = const T &;
+    using pointer = T *;
+    using const_pointer = const T *;
+    using iterator = T *;
+    using const_iterator = const T *;
+
+    SmallVector() = default;
+
+    /**
+     * @brief Construct a vector with size copies of value.
+     * @param size Number of elements.
+     * @param value Value of the elements.
+     */
+    SmallVector(size_t size, const T &value) { assign(size, value); }
+
+    /**
+     * @brief Construct a vector from the given elements.
+     * @param values Elements of the vector.
+     */
+    SmallVector(std::initializer_list<T> values) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Construct a vector from the elements of a std::vector.
+     *
+     * The element types may differ, e.g. size_t and hsize_t.
+     * @param values Elements of the vector.
+     */
+    template <typename U>
+    SmallVector(const std::vector<U> &values) {
+        assign(values.begin(), values.end());
+    }
+
+    /**
+     * @brief Copy the elements into a std::vector.
+     *
+     * Allows passing the vector to interfaces which expect a std::vector.
+     */
+    template <typename U> operator std::vector<U>() const {
+        return std::vector<U>(begin(), end());
+    }
+
+    /**
+     * @brief Replace the content with the elements of the given range.
+     * @param first Begin of the range.
+     * @param last End of the range.
+     */
+    template <typename InputIt> void assign(InputIt first, InputIt last) {
+        clear();
+        for (; first != last; ++first) {
+            push_back(static_cast<T>(*first));
+        }
+    }
+
+    /**
+     * @brief Replace the content with size copies of value.
+     * @param size Number of elements.
+     * @param value Value of the elements.
+     */
+    void assign(size_t size, const T &value) {
+        clear();
+        resize(size, value);
+    }
+
+    /**
+     * @brief Append an element. Moves the elements to the heap once the
+     * inline capacity is exceeded.
+     * @param value Element to append.
+     */
+    void push_back(const T &value) {
+        if (m_size < N) {
+            m_inline[m_size] = value;
+        } else {
+            if (m_size == N) {
+                m_heap.assign(m_inline.begin(), m_inline.end());
+            }
+            m_heap.push_back(value);
+        }
+        ++m_size;
+    }
+
+    /**
+     * @brief Change the number of elements.
+     * @param size New number of elements.
+     * @param value Value of appended elements.
+     */
+    void resize(size_t size, const T &value = T()) {
+        if (size <= N) {
+            if (m_size > N) {
+                std::copy_n(m_heap.begin(), size, m_inline.begin());
+                m_heap.clear();
+            } else if (size > m_size) {
+                std::fill(m_inline.begin() + m_size, m_inline.begin() + size,
+                          value);
+            }
+            m_size = size;
+            return;
+        }
+        while (m_size < size) {
+            push_back(value);
+        }
+        if (m_size > size) {
+            m_heap.resize(size);
+            m_size = size;
+        }
+    }
+
+    /**
+     * @brief Remove all elements.
+     */
+    void clear() noexcept {
+        m_heap.clear();
+        m_size = 0;
+    }
+
+    size_t size() const noexcept { return m_size; }
+    bool empty() const noexcept { return m_size == 0; }
+
+    T *data() noexcept { return m_size > N ? m_heap.data() : m_inline.data(); }
+    const T *data() const noexcept {
+        return m_size > N ? m_heap.data() : m_inline.data();
+    }
+
+    T &operator[](size_t i) noexcept { return data()[i]; }
+    const T &operator[](size_t i) const noexcept { return data()[i]; }
+
+    T &front() noexcept { return data()[0]; }
+    const T &front() const noexcept { return data()[0]; }
+    T &back() noexcept { return data()[m_size - 1]; }
+    const T &back() const noexcept { return data()[m_size - 1]; }
+
+    iterator begin() noexcept { return data(); }
+    iterator end() noexcept { return data() + m_size; }
+    const_iterator begin() const noexcept { return data(); }
+    const_iterator end() const noexcept { return data() + m_size; }
+    const_iterator cbegin() const noexcept { return data(); }
+    const_iterator cend() const noexcept { return data() + m_size; }
+
+    friend bool operator==(const SmallVector &lhs, const SmallVector &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+    template <typename U>
+    friend bool operator==(const SmallVector &lhs, const std::vector<U> &rhs) {
+        return std::equal(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+    }
+
+  private:
+    std::array<T, N> m_inline{};
+    std::vector<T> m_heap;
+    size_t m_size{0};
+};
+} // namespace HDF5
+} // namespace PLI
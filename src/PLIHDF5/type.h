@@ -31,6 +31,7 @@
 #include <string>
 
 #include "PLIHDF5/exceptions.h"
+#include "PLIHDF5/typetraits.h"
 
 /**
  * @brief The PLI namespace
@@ -42,6 +43,14 @@ namespace PLI {
 namespace HDF5 {
 class Type {
   public:
+    /**
+     * @brief Get the HDF5 datatype of a C++ type.
+     *
+     * The datatype is looked up through PLI::HDF5::TypeTraits without parsing
+     * or creating a new identifier.
+     * @tparam T C++ type, see PLI::HDF5::TypeTraits for supported types.
+     * @return PLI::HDF5::Type Datatype of T.
+     */
     template <typename T> static PLI::HDF5::Type createType();
 
     explicit Type(const std::string &typeName);
@@ -62,3 +71,5 @@ class Type {
 };
 } // namespace HDF5
 } // namespace PLI
+
+#include "PLIHDF5/type.tpp"
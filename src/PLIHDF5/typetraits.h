@@ -0,0 +1,216 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#pragma once
+
+#include <hdf5.h>
+
+#include <array>
+#include <complex>
+#include <cstddef>
+#include <initializer_list>
+#include <type_traits>
+
+/**
+ * @brief The PLI namespace
+ */
+namespace PLI {
+/**
+ * @brief The HDF5 namespace
+ */
+namespace HDF5 {
+/**
+ * @brief Member of a compound datatype.
+ */
+struct CompoundMember {
+    /// Name of the member in the file.
+    const char *name;
+    /// Offset of the member in bytes, i.e. offsetof(Struct, member).
+    size_t offset;
+    /// HDF5 datatype of the member.
+    hid_t typeID;
+};
+
+/**
+ * @brief Create a compound datatype from its members.
+ * @param size Size of the C++ struct in bytes.
+ * @param members Members of the struct.
+ * @return hid_t New compound datatype.
+ * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the datatype could
+ * not be created.
+ */
+hid_t createCompoundType(size_t size,
+                         std::initializer_list<CompoundMember> members);
+
+/**
+ * @brief Create a one-dimensional array datatype.
+ * @param baseTypeID HDF5 datatype of the elements.
+ * @param size Number of elements.
+ * @return hid_t New array datatype.
+ * @throws PLI::HDF5::Exceptions::HDF5RuntimeException If the datatype could
+ * not be created.
+ */
+hid_t createArrayType(hid_t baseTypeID, size_t size);
+
+/**
+ * @brief Maps a C++ type to its HDF5 datatype at compile time.
+ *
+ * TypeTraits<T>::id() returns the predefined native HDF5 datatype of T. No
+ * type name is parsed and no new identifier is created. Datatypes which are
+ * not predefined by HDF5 (std::complex, std::array and registered compound
+ * types) are created once on first use and kept until the program ends. The
+ * returned identifiers must not be closed.
+ * @tparam T C++ type. Using an unsupported type fails at compile time.
+ */
+template <typename T, typename Enable = void> struct TypeTraits {
+    static_assert(!std::is_same_v<T, T>,
+                  "No HDF5 datatype is known for this type. Compound types "
+                  "can be registered with PLI_HDF5_COMPOUND_TYPE.");
+};
+
+/// Const qualified types use the datatype of the unqualified type.
+template <typename T>
+struct TypeTraits<T, std::enable_if_t<std::is_const_v<T>>>
+    : TypeTraits<std::remove_const_t<T>> {};
+
+template <> struct TypeTraits<bool> {
+    static_assert(sizeof(hbool_t) == sizeof(bool),
+                  "HDF5 boolean type differs from bool.");
+    static hid_t id() { return H5T_NATIVE_HBOOL; }
+};
+
+template <> struct TypeTraits<char> {
+    static hid_t id() { return H5T_NATIVE_CHAR; }
+};
+
+template <> struct TypeTraits<signed char> {
+    static hid_t id() { return H5T_NATIVE_SCHAR; }
+};
+
+template <> struct TypeTraits<unsigned char> {
+    static hid_t id() { return H5T_NATIVE_UCHAR; }
+};
+
+template <> struct TypeTraits<short> {
+    static hid_t id() { return H5T_NATIVE_SHORT; }
+};
+
+template <> struct TypeTraits<unsigned short> {
+    static hid_t id() { return H5T_NATIVE_USHORT; }
+};
+
+template <> struct TypeTraits<int> {
+    static hid_t id() { return H5T_NATIVE_INT; }
+};
+
+template <> struct TypeTraits<unsigned int> {
+    static hid_t id() { return H5T_NATIVE_UINT; }
+};
+
+template <> struct TypeTraits<long> {
+    static hid_t id() { return H5T_NATIVE_LONG; }
+};
+
+template <> struct TypeTraits<unsigned long> {
+    static hid_t id() { return H5T_NATIVE_ULONG; }
+};
+
+template <> struct TypeTraits<long long> {
+    static hid_t id() { return H5T_NATIVE_LLONG; }
+};
+
+template <> struct TypeTraits<unsigned long long> {
+    static hid_t id() { return H5T_NATIVE_ULLONG; }
+};
+
+template <> struct TypeTraits<float> {
+    static hid_t id() { return H5T_NATIVE_FLOAT; }
+};
+
+template <> struct TypeTraits<double> {
+    static hid_t id() { return H5T_NATIVE_DOUBLE; }
+};
+
+template <> struct TypeTraits<long double> {
+    static hid_t id() { return H5T_NATIVE_LDOUBLE; }
+};
+
+/// Complex numbers are stored as compound of the members "r" and "i", which
+/// matches the layout used by h5py.
+template <typename T> struct TypeTraits<std::complex<T>> {
+    static hid_t id() {
+        static const hid_t typeID = createCompoundType(
+            sizeof(std::complex<T>), {{"r", 0, TypeTraits<T>::id()},
+                                      {"i", sizeof(T), TypeTraits<T>::id()}});
+        return typeID;
+    }
+};
+
+/// Fixed-size arrays are stored as HDF5 array datatype.
+template <typename T, size_t N> struct TypeTraits<std::array<T, N>> {
+    static hid_t id() {
+        static const hid_t typeID = createArrayType(TypeTraits<T>::id(), N);
+        return typeID;
+    }
+};
+} // namespace HDF5
+} // namespace PLI
+
+/**
+ * @brief Member entry of PLI_HDF5_COMPOUND_TYPE.
+ * @param STRUCT Name of the struct.
+ * @param MEMBER Name of the member. It is also used as name in the file.
+ */
+#define PLI_HDF5_MEMBER(STRUCT, MEMBER)                                        \
+    PLI::HDF5::CompoundMember {                                                \
+        #MEMBER, offsetof(STRUCT, MEMBER),                                     \
+            PLI::HDF5::TypeTraits<decltype(STRUCT::MEMBER)>::id()              \
+    }
+
+/**
+ * @brief Register a struct as HDF5 compound datatype.
+ *
+ * Has to be used in the global namespace. Afterwards, the struct can be used
+ * with all templated read and write methods. Example:
+ * @code
+ * struct Point { float x; float y; };
+ * PLI_HDF5_COMPOUND_TYPE(Point, PLI_HDF5_MEMBER(Point, x),
+ *                        PLI_HDF5_MEMBER(Point, y))
+ * @endcode
+ * @param STRUCT Name of the struct.
+ * @param ... Members of the struct, each given by PLI_HDF5_MEMBER.
+ */
+#define PLI_HDF5_COMPOUND_TYPE(STRUCT, ...)                                    \
+    namespace PLI {                                                            \
+    namespace HDF5 {                                                           \
+    template <> struct TypeTraits<STRUCT> {                                    \
+        static hid_t id() {                                                    \
+            static const hid_t typeID =                                        \
+                createCompoundType(sizeof(STRUCT), {__VA_ARGS__});             \
+            return typeID;                                                     \
+        }                                                                      \
+    };                                                                         \
+    }                                                                          \
+    }
@@ -0,0 +1,161 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/asyncio.h"
+
+#include <chrono>
+#include <utility>
+
+#include "PLIHDF5/exceptions.h"
+
+PLI::HDF5::IOHandle::IOHandle(std::shared_future<void> future) noexcept
+    : m_future(std::move(future)) {}
+
+bool PLI::HDF5::IOHandle::valid() const noexcept { return m_future.valid(); }
+
+bool PLI::HDF5::IOHandle::ready() const {
+    return !m_future.valid() || m_future.wait_for(std::chrono::seconds(0)) ==
+                                    std::future_status::ready;
+}
+
+void PLI::HDF5::IOHandle::wait() const {
+    if (m_future.valid()) {
+        m_future.get();
+    }
+}
+
+PLI::HDF5::IOQueue *PLI::HDF5::IOQueue::getInstance() {
+    // Constructed on first use, which is after HDF5 was initialized. The
+    // queue is therefore destroyed, and pending operations are finished,
+    // before HDF5 shuts down at exit.
+    static IOQueue instance;
+    return &instance;
+}
+
+PLI::HDF5::IOQueue::~IOQueue() {
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_stop = true;
+    }
+    m_operationAdded.notify_all();
+    if (m_thread.joinable()) {
+        m_thread.join();
+    }
+}
+
+PLI::HDF5::IOHandle
+PLI::HDF5::IOQueue::submit(const hid_t fileID,
+                           std::function<void()> operation,
+                           const bool background) {
+    // Operations only run in the background with a thread-safe HDF5
+    // library, so the calls of this thread need no lock.
+    hbool_t threadSafe = false;
+    checkHDF5Call(H5is_library_threadsafe(&threadSafe),
+                  "H5is_library_threadsafe");
+    // The identifier must not be reused for another file while waitAll may
+    // still wait for it. It is released by execute.
+    checkHDF5Call(H5Iinc_ref(fileID), "H5Iinc_ref");
+    Operation queued{fileID, std::move(operation), std::promise<void>()};
+    IOHandle handle(queued.promise.get_future().share());
+    if (!background || !threadSafe) {
+        // Operations of the same file submitted before have to finish first.
+        waitAll(fileID);
+        execute(queued);
+        return handle;
+    }
+
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (!m_thread.joinable()) {
+            m_thread = std::thread(&IOQueue::run, this);
+        }
+        ++m_pending[fileID];
+        m_operations.push_back(std::move(queued));
+    }
+    m_operationAdded.notify_one();
+    return handle;
+}
+
+void PLI::HDF5::IOQueue::waitAll(const hid_t fileID) {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_operationFinished.wait(
+        lock, [this, fileID]() { return !m_pending.contains(fileID); });
+}
+
+void PLI::HDF5::IOQueue::waitAll() {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_operationFinished.wait(lock, [this]() { return m_pending.empty(); });
+}
+
+std::unique_lock<std::mutex> PLI::HDF5::IOQueue::lockHDF5() {
+    return std::unique_lock<std::mutex>(m_hdf5Mutex);
+}
+
+void PLI::HDF5::IOQueue::run() {
+    while (true) {
+        Operation operation;
+        {
+            std::unique_lock<std::mutex> lock(m_mutex);
+            m_operationAdded.wait(
+                lock, [this]() { return m_stop || !m_operations.empty(); });
+            // Pending operations are finished before stopping.
+            if (m_operations.empty()) {
+                return;
+            }
+            operation = std::move(m_operations.front());
+            m_operations.pop_front();
+        }
+        execute(operation);
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            if (--m_pending[operation.fileID] == 0) {
+                m_pending.erase(operation.fileID);
+            }
+        }
+        m_operationFinished.notify_all();
+    }
+}
+
+void PLI::HDF5::IOQueue::execute(Operation &operation) {
+    std::exception_ptr exception;
+    {
+        auto lock = lockHDF5();
+        try {
+            operation.function();
+        } catch (...) {
+            exception = std::current_exception();
+        }
+        // Release captured HDF5 objects while holding the lock and before
+        // the handle becomes ready.
+        operation.function = nullptr;
+        H5Idec_ref(operation.fileID);
+    }
+    // Exceptions are rethrown by IOHandle::wait.
+    if (exception) {
+        operation.promise.set_exception(exception);
+    } else {
+        operation.promise.set_value();
+    }
+}
@@ -0,0 +1,229 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/chunkgrid.h"
+
+#include <algorithm>
+#include <string>
+
+#include "PLIHDF5/exceptions.h"
+
+PLI::HDF5::ChunkGrid::ChunkGrid(const std::vector<size_t> &dims,
+                                const std::vector<size_t> &chunkDims,
+                                const std::vector<size_t> &origin)
+    : m_dims(dims), m_chunkDims(chunkDims),
+      m_origin(origin.empty() ? std::vector<size_t>(dims.size(), 0) : origin),
+      m_gridDims(dims.size()), m_size(dims.empty() ? 0 : 1) {
+    if (m_chunkDims.size() != m_dims.size() ||
+        m_origin.size() != m_dims.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Chunk dimensions and origin must have the same size as the "
+            "dataset dimensions.");
+    }
+    for (size_t i = 0; i < m_dims.size(); ++i) {
+        if (m_chunkDims[i] == 0) {
+            throw Exceptions::DimensionMismatchException(
+                "Chunk dimensions must be greater than zero.");
+        }
+        m_gridDims[i] = m_origin[i] < m_dims[i]
+                            ? (m_dims[i] - m_origin[i] + m_chunkDims[i] - 1) /
+                                  m_chunkDims[i]
+                            : 0;
+        m_size *= m_gridDims[i];
+    }
+}
+
+size_t PLI::HDF5::ChunkGrid::size() const noexcept { return m_size; }
+
+bool PLI::HDF5::ChunkGrid::empty() const noexcept { return m_size == 0; }
+
+size_t PLI::HDF5::ChunkGrid::ndims() const noexcept { return m_dims.size(); }
+
+const std::vector<size_t> &PLI::HDF5::ChunkGrid::dims() const noexcept {
+    return m_dims;
+}
+
+const std::vector<size_t> &PLI::HDF5::ChunkGrid::chunkDims() const noexcept {
+    return m_chunkDims;
+}
+
+const std::vector<size_t> &PLI::HDF5::ChunkGrid::gridDims() const noexcept {
+    return m_gridDims;
+}
+
+PLI::HDF5::Dataset::Hyperslab
+PLI::HDF5::ChunkGrid::operator[](size_t index) const {
+    Dataset::Hyperslab::Extent offset(m_dims.size(), 0);
+    Dataset::Hyperslab::Extent count(m_dims.size(), 0);
+    for (size_t i = m_dims.size(); i-- > 0;) {
+        offset[i] = m_origin[i] + (index % m_gridDims[i]) * m_chunkDims[i];
+        count[i] = std::min<hsize_t>(m_chunkDims[i], m_dims[i] - offset[i]);
+        index /= m_gridDims[i];
+    }
+    return Dataset::Hyperslab(offset, count);
+}
+
+PLI::HDF5::Dataset::Hyperslab PLI::HDF5::ChunkGrid::at(size_t index) const {
+    if (index >= m_size) {
+        throw Exceptions::DimensionMismatchException(
+            "Chunk index " + std::to_string(index) +
+            " exceeds the number of chunks " + std::to_string(m_size) + ".");
+    }
+    return (*this)[index];
+}
+
+std::vector<size_t> PLI::HDF5::ChunkGrid::chunkCoordinates(size_t index) const {
+    std::vector<size_t> coordinates(m_dims.size());
+    for (size_t i = m_dims.size(); i-- > 0;) {
+        coordinates[i] = index % m_gridDims[i];
+        index /= m_gridDims[i];
+    }
+    return coordinates;
+}
+
+size_t PLI::HDF5::ChunkGrid::chunkIndex(
+    const std::vector<size_t> &chunkCoordinates) const {
+    if (chunkCoordinates.size() != m_dims.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Chunk coordinates must have the same size as the dimensions.");
+    }
+    size_t index = 0;
+    for (size_t i = 0; i < m_dims.size(); ++i) {
+        if (chunkCoordinates[i] >= m_gridDims[i]) {
+            throw Exceptions::DimensionMismatchException(
+                "Chunk coordinates are outside of the chunk grid.");
+        }
+        index = index * m_gridDims[i] + chunkCoordinates[i];
+    }
+    return index;
+}
+
+size_t PLI::HDF5::ChunkGrid::chunkIndexOf(
+    const std::vector<size_t> &coordinates) const {
+    if (coordinates.size() != m_dims.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Coordinates must have the same size as the dimensions.");
+    }
+    size_t index = 0;
+    for (size_t i = 0; i < m_dims.size(); ++i) {
+        if (coordinates[i] < m_origin[i] || coordinates[i] >= m_dims[i]) {
+            throw Exceptions::DimensionMismatchException(
+                "Coordinates are outside of the chunk grid.");
+        }
+        index = index * m_gridDims[i] +
+                (coordinates[i] - m_origin[i]) / m_chunkDims[i];
+    }
+    return index;
+}
+
+PLI::HDF5::ChunkGrid::iterator PLI::HDF5::ChunkGrid::begin() const noexcept {
+    return iterator(this, 0);
+}
+
+PLI::HDF5::ChunkGrid::iterator PLI::HDF5::ChunkGrid::end() const noexcept {
+    return iterator(this, m_size);
+}
+
+std::vector<PLI::HDF5::Dataset::Hyperslab>
+PLI::HDF5::ChunkGrid::toVector() const {
+    return std::vector<Dataset::Hyperslab>(begin(), end());
+}
+
+/*
+ * PLI::HDF5::ChunkGrid::Iterator
+ */
+PLI::HDF5::ChunkGrid::Iterator::Iterator(const ChunkGrid *grid,
+                                         size_t index) noexcept
+    : m_grid(grid), m_index(index) {}
+
+PLI::HDF5::ChunkGrid::Iterator::reference
+PLI::HDF5::ChunkGrid::Iterator::operator*() const {
+    return (*m_grid)[m_index];
+}
+
+PLI::HDF5::ChunkGrid::Iterator::reference
+PLI::HDF5::ChunkGrid::Iterator::operator[](difference_type offset) const {
+    return (*m_grid)[m_index + offset];
+}
+
+PLI::HDF5::ChunkGrid::Iterator &
+PLI::HDF5::ChunkGrid::Iterator::operator++() noexcept {
+    ++m_index;
+    return *this;
+}
+
+PLI::HDF5::ChunkGrid::Iterator
+PLI::HDF5::ChunkGrid::Iterator::operator++(int) noexcept {
+    Iterator previous = *this;
+    ++m_index;
+    return previous;
+}
+
+PLI::HDF5::ChunkGrid::Iterator &
+PLI::HDF5::ChunkGrid::Iterator::operator--() noexcept {
+    --m_index;
+    return *this;
+}
+
+PLI::HDF5::ChunkGrid::Iterator
+PLI::HDF5::ChunkGrid::Iterator::operator--(int) noexcept {
+    Iterator previous = *this;
+    --m_index;
+    return previous;
+}
+
+PLI::HDF5::ChunkGrid::Iterator &
+PLI::HDF5::ChunkGrid::Iterator::operator+=(difference_type offset) noexcept {
+    m_index += offset;
+    return *this;
+}
+
+PLI::HDF5::ChunkGrid::Iterator &
+PLI::HDF5::ChunkGrid::Iterator::operator-=(difference_type offset) noexcept {
+    m_index -= offset;
+    return *this;
+}
+
+PLI::HDF5::ChunkGrid::Iterator PLI::HDF5::ChunkGrid::Iterator::operator+(
+    difference_type offset) const noexcept {
+    return Iterator(m_grid, m_index + offset);
+}
+
+PLI::HDF5::ChunkGrid::Iterator PLI::HDF5::ChunkGrid::Iterator::operator-(
+    difference_type offset) const noexcept {
+    return Iterator(m_grid, m_index - offset);
+}
+
+PLI::HDF5::ChunkGrid::Iterator::difference_type
+PLI::HDF5::ChunkGrid::Iterator::operator-(
+    const Iterator &other) const noexcept {
+    return static_cast<difference_type>(m_index) -
+           static_cast<difference_type>(other.m_index);
+}
+
+bool PLI::HDF5::ChunkGrid::Iterator::operator==(
+    const Iterator &other) const noexcept {
+    return m_grid == other.m_grid && m_index == other.m_index;
+}
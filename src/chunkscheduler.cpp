@@ -0,0 +1,243 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/chunkscheduler.h"
+
+#include <algorithm>
+#include <numeric>
+
+#include "PLIHDF5/exceptions.h"
+
+PLI::HDF5::ChunkScheduler::ChunkScheduler(const Dataset &dataset,
+                                          const ChunkScheduleOptions &options)
+    : ChunkScheduler(dataset, dataset.chunkGrid(), options) {}
+
+PLI::HDF5::ChunkScheduler::ChunkScheduler(const Dataset &dataset,
+                                          const ChunkGrid &grid,
+                                          const ChunkScheduleOptions &options)
+    : m_grid(grid), m_options(options),
+      m_communicator(dataset.communicator()), m_rank(0), m_size(1),
+      m_total(0), m_position(0), m_window(MPI_WIN_NULL), m_counter(nullptr) {
+    checkHDF5Ptr(dataset, "PLI::HDF5::ChunkScheduler");
+    if (m_communicator.has_value()) {
+        MPI_Comm_rank(m_communicator.value(), &m_rank);
+        MPI_Comm_size(m_communicator.value(), &m_size);
+    }
+
+    const std::vector<uint64_t> weights = chunkWeights(dataset);
+    const std::vector<size_t> order = chunkOrder(weights);
+    m_total = order.size();
+    if (m_options.schedule == ChunkSchedule::WorkStealing) {
+        m_order = order;
+        createCounter();
+    } else {
+        assignChunks(order, weights);
+    }
+}
+
+PLI::HDF5::ChunkScheduler::~ChunkScheduler() {
+    if (m_window != MPI_WIN_NULL) {
+        MPI_Win_free(&m_window);
+    }
+}
+
+std::optional<size_t> PLI::HDF5::ChunkScheduler::next() {
+    if (m_options.schedule != ChunkSchedule::WorkStealing) {
+        if (m_position >= m_chunks.size()) {
+            return std::nullopt;
+        }
+        return m_chunks[m_position++];
+    }
+
+    uint64_t position = m_position++;
+    if (m_window != MPI_WIN_NULL) {
+        const uint64_t increment = 1;
+        MPI_Win_lock(MPI_LOCK_SHARED, 0, 0, m_window);
+        MPI_Fetch_and_op(&increment, &position, MPI_UINT64_T, 0, 0, MPI_SUM,
+                         m_window);
+        MPI_Win_unlock(0, m_window);
+    }
+    if (position >= m_order.size()) {
+        return std::nullopt;
+    }
+    return m_order[position];
+}
+
+const std::vector<size_t> &
+PLI::HDF5::ChunkScheduler::assignedChunks() const noexcept {
+    return m_chunks;
+}
+
+size_t PLI::HDF5::ChunkScheduler::size() const noexcept { return m_total; }
+
+const PLI::HDF5::ChunkGrid &PLI::HDF5::ChunkScheduler::grid() const noexcept {
+    return m_grid;
+}
+
+PLI::HDF5::ChunkSchedule
+PLI::HDF5::ChunkScheduler::schedule() const noexcept {
+    return m_options.schedule;
+}
+
+uint64_t PLI::HDF5::ChunkScheduler::hilbertIndex(uint64_t order, uint64_t x,
+                                                 uint64_t y) {
+    uint64_t index = 0;
+    for (uint64_t s = order / 2; s > 0; s /= 2) {
+        const uint64_t rx = (x & s) > 0 ? 1 : 0;
+        const uint64_t ry = (y & s) > 0 ? 1 : 0;
+        index += s * s * ((3 * rx) ^ ry);
+        // Rotate the quadrant, so that the curve continues at its end.
+        if (ry == 0) {
+            if (rx == 1) {
+                x = order - 1 - x;
+                y = order - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return index;
+}
+
+std::vector<uint64_t>
+PLI::HDF5::ChunkScheduler::chunkWeights(const Dataset &dataset) const {
+    const bool needsWeights =
+        m_options.skipUnallocated ||
+        (m_options.weightByStoredSize &&
+         m_options.schedule != ChunkSchedule::WorkStealing);
+    // The stored size can only be queried for the chunks of the dataset.
+    if (!needsWeights || m_grid.empty() || !dataset.isChunked() ||
+        m_grid.dims() != dataset.dims() ||
+        m_grid.chunkDims() != dataset.chunkDims()) {
+        return {};
+    }
+    const Dataset::Hyperslab first = m_grid[0];
+    if (std::any_of(first.offset().begin(), first.offset().end(),
+                    [](const hsize_t offset) { return offset != 0; })) {
+        return {};
+    }
+
+    // Only the first process queries the file and shares the result. HDF5
+    // before 1.12 reports an error instead of a size of zero for chunks which
+    // are not allocated.
+    std::vector<uint64_t> weights(m_grid.size(), 0);
+    if (m_rank == 0) {
+        H5E_BEGIN_TRY {
+            for (size_t i = 0; i < m_grid.size(); ++i) {
+                hsize_t bytes = 0;
+                if (H5Dget_chunk_storage_size(dataset.id(),
+                                              m_grid[i].offset().data(),
+                                              &bytes) >= 0) {
+                    weights[i] = bytes;
+                }
+            }
+        }
+        H5E_END_TRY;
+    }
+    if (m_communicator.has_value()) {
+        MPI_Bcast(weights.data(), static_cast<int>(weights.size()),
+                  MPI_UINT64_T, 0, m_communicator.value());
+    }
+    return weights;
+}
+
+std::vector<size_t> PLI::HDF5::ChunkScheduler::chunkOrder(
+    const std::vector<uint64_t> &weights) const {
+    std::vector<size_t> order;
+    order.reserve(m_grid.size());
+    for (size_t i = 0; i < m_grid.size(); ++i) {
+        if (!m_options.skipUnallocated || weights.empty() || weights[i] > 0) {
+            order.push_back(i);
+        }
+    }
+    if (m_options.schedule == ChunkSchedule::Static || m_grid.ndims() < 2) {
+        return order;
+    }
+
+    // Follow a Hilbert curve through the first two grid dimensions. Chunks
+    // which only differ in further dimensions stay in row-major order.
+    const std::vector<size_t> &gridDims = m_grid.gridDims();
+    const size_t rowStride =
+        std::accumulate(gridDims.begin() + 2, gridDims.end(), size_t{1},
+                        std::multiplies<size_t>());
+    uint64_t curveOrder = 1;
+    while (curveOrder < std::max(gridDims[0], gridDims[1])) {
+        curveOrder *= 2;
+    }
+    std::vector<uint64_t> keys(m_grid.size(), 0);
+    for (const size_t index : order) {
+        const size_t plane = index / rowStride;
+        keys[index] = hilbertIndex(curveOrder, plane / gridDims[1],
+                                   plane % gridDims[1]);
+    }
+    std::stable_sort(order.begin(), order.end(),
+                     [&keys](const size_t lhs, const size_t rhs) {
+                         return keys[lhs] < keys[rhs];
+                     });
+    return order;
+}
+
+void PLI::HDF5::ChunkScheduler::assignChunks(
+    const std::vector<size_t> &order, const std::vector<uint64_t> &weights) {
+    const bool weighted = m_options.weightByStoredSize && !weights.empty();
+    const auto weight = [&weights, weighted](const size_t index) {
+        return weighted ? std::max<uint64_t>(weights[index], 1) : uint64_t{1};
+    };
+    uint64_t total = 0;
+    for (const size_t index : order) {
+        total += weight(index);
+    }
+
+    // Cut the order into one segment of about the same weight per process.
+    // Each chunk belongs to the segment containing its center.
+    uint64_t prefix = 0;
+    for (const size_t index : order) {
+        const uint64_t chunkWeight = weight(index);
+        const double center = (static_cast<double>(prefix) +
+                               static_cast<double>(chunkWeight) / 2) /
+                              static_cast<double>(total);
+        const int rank = std::min(
+            m_size - 1, static_cast<int>(center * static_cast<double>(m_size)));
+        if (rank == m_rank) {
+            m_chunks.push_back(index);
+        }
+        prefix += chunkWeight;
+    }
+}
+
+void PLI::HDF5::ChunkScheduler::createCounter() {
+    if (!m_communicator.has_value()) {
+        return;
+    }
+    // The counter of the next chunk is located on the first process.
+    const MPI_Aint bytes = m_rank == 0 ? sizeof(uint64_t) : 0;
+    MPI_Win_allocate(bytes, sizeof(uint64_t), MPI_INFO_NULL,
+                     m_communicator.value(), &m_counter, &m_window);
+    if (m_rank == 0) {
+        MPI_Win_lock(MPI_LOCK_EXCLUSIVE, 0, 0, m_window);
+        *m_counter = 0;
+        MPI_Win_unlock(0, m_window);
+    }
+    MPI_Barrier(m_communicator.value());
+}
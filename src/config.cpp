@@ -73,6 +73,7 @@ std::string PLI::HDF5::Config::getConfigFilePath() noexcept {
 void PLI::HDF5::Config::setConfigFilePath(const std::string &path) noexcept {
     std::cout << path << std::endl;
     configFilePath = path;
+    fileAccessOptions.reset();
 }
 
 std::vector<std::string> PLI::HDF5::Config::getExcludedCopyAttributes() {
@@ -117,6 +118,75 @@ std::vector<std::string> PLI::HDF5::Config::getIDAttributes() {
     return idAttributes;
 }
 
+PLI::HDF5::FileAccessOptions PLI::HDF5::Config::getFileAccessOptions() {
+    // Every file is opened with these options. Reading the config file for
+    // each of them would put load on the file system from all MPI processes.
+    if (fileAccessOptions) {
+        return fileAccessOptions.value();
+    }
+
+    using json = nlohmann::json;
+    json j;
+
+    if (!std::filesystem::exists(getConfigFilePath())) {
+        fileAccessOptions = FileAccessOptions();
+        return fileAccessOptions.value();
+    }
+    std::ifstream configFile(getConfigFilePath());
+    if (!configFile.is_open()) {
+        throw std::runtime_error("Config file " + getConfigFilePath() +
+                                 " could not be opened.");
+    }
+    configFile >> j;
+
+    FileAccessOptions options;
+    if (!j.contains("file_access")) {
+        fileAccessOptions = options;
+        return options;
+    }
+    const json &access = j["file_access"];
+    if (access.contains("mpi_hints")) {
+        // MPI_Info only stores strings. Numbers are allowed in the config
+        // file for convenience, e.g. "striping_factor": 16.
+        for (const auto &[key, value] : access["mpi_hints"].items()) {
+            options.mpiHints[key] =
+                value.is_string() ? value.get<std::string>() : value.dump();
+        }
+    }
+    if (access.contains("collective_metadata_reads")) {
+        options.collectiveMetadataReads =
+            access["collective_metadata_reads"].get<bool>();
+    }
+    if (access.contains("collective_metadata_writes")) {
+        options.collectiveMetadataWrites =
+            access["collective_metadata_writes"].get<bool>();
+    }
+    if (access.contains("alignment_threshold")) {
+        options.alignmentThreshold =
+            access["alignment_threshold"].get<size_t>();
+    }
+    if (access.contains("alignment")) {
+        options.alignment = access["alignment"].get<size_t>();
+    }
+    if (access.contains("metadata_block_size")) {
+        options.metadataBlockSize =
+            access["metadata_block_size"].get<size_t>();
+    }
+    if (access.contains("page_buffer_size")) {
+        options.pageBufferSize = access["page_buffer_size"].get<size_t>();
+    }
+    if (access.contains("page_buffer_min_metadata_percent")) {
+        options.pageBufferMinMetadataPercent =
+            access["page_buffer_min_metadata_percent"].get<unsigned>();
+    }
+    if (access.contains("page_buffer_min_raw_data_percent")) {
+        options.pageBufferMinRawDataPercent =
+            access["page_buffer_min_raw_data_percent"].get<unsigned>();
+    }
+    fileAccessOptions = options;
+    return options;
+}
+
 bool PLI::HDF5::Config::exceptionPrintingEnabled() const {
     return _exceptionPrintingEnabled;
 }
@@ -27,7 +27,13 @@
 
 #include <mpi.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
 #include <iostream>
+#include <limits>
+#include <map>
+#include <numeric>
 
 #include "PLIHDF5/exceptions.h"
 
@@ -39,15 +45,32 @@ PLI::HDF5::Dataset PLI::HDF5::Folder::createDataset(
     return dataset;
 }
 
+PLI::HDF5::Dataset PLI::HDF5::Folder::createDataset(
+    const std::string &datasetName, const std::vector<size_t> &dims,
+    std::initializer_list<size_t> chunkDims, const PLI::HDF5::Type &dataType) {
+    return this->createDataset(datasetName, dims,
+                               std::vector<size_t>(chunkDims), dataType);
+}
+
+PLI::HDF5::Dataset PLI::HDF5::Folder::createDataset(
+    const std::string &datasetName, const std::vector<size_t> &dims,
+    const DatasetCreateOptions &options, const PLI::HDF5::Type &dataType) {
+    PLI::HDF5::Dataset dataset;
+    dataset.create(*this, datasetName, dims, options, dataType);
+    return dataset;
+}
+
 PLI::HDF5::Dataset
-PLI::HDF5::Folder::openDataset(const std::string &datasetName) {
+PLI::HDF5::Folder::openDataset(const std::string &datasetName,
+                               const DatasetAccessOptions &options) {
     PLI::HDF5::Dataset dataset;
-    dataset.open(*this, datasetName);
+    dataset.open(*this, datasetName, options);
     return dataset;
 }
 
 void PLI::HDF5::Dataset::open(const Folder &parentPtr,
-                              const std::string &datasetName) {
+                              const std::string &datasetName,
+                              const DatasetAccessOptions &options) {
     checkHDF5Ptr(parentPtr, "PLI::HDF5::Dataset::open");
     if (!exists(parentPtr, datasetName)) {
         throw PLI::HDF5::Exceptions::DatasetNotFoundException(
@@ -57,6 +80,103 @@ void PLI::HDF5::Dataset::open(const Folder &parentPtr,
     checkHDF5Ptr(datasetPtr, "H5Dopen");
     this->m_id = datasetPtr;
     this->m_communicator = parentPtr.communicator();
+    this->m_transferMode = parentPtr.transferMode();
+    this->resetMetadata();
+
+    if (options.cacheBytes.has_value() || options.cacheSlots.has_value() ||
+        options.preemption.has_value() || options.accessPattern.has_value()) {
+        // The chunk cache can only be configured when opening the dataset.
+        // Sizing it automatically requires the layout of the dataset, so the
+        // dataset is opened a second time.
+        const Metadata &metadata = this->metadata();
+        hid_t dapl_id =
+            createAccessPlist(options, metadata.dims, metadata.chunkDims,
+                              H5Tget_size(metadata.typeID));
+        checkHDF5Call(H5Dclose(datasetPtr), "H5Dclose");
+
+        datasetPtr = H5Dopen(parentPtr, datasetName.c_str(), dapl_id);
+        checkHDF5Call(H5Pclose(dapl_id), "H5Pclose");
+        checkHDF5Ptr(datasetPtr, "H5Dopen");
+        this->m_id = datasetPtr;
+    }
+}
+
+hid_t PLI::HDF5::Dataset::createAccessPlist(
+    const DatasetAccessOptions &options, const std::vector<size_t> &dims,
+    const std::vector<size_t> &chunkDims, const size_t typeSize) {
+    size_t cacheSlots = H5D_CHUNK_CACHE_NSLOTS_DEFAULT;
+    size_t cacheBytes = H5D_CHUNK_CACHE_NBYTES_DEFAULT;
+    double preemption = H5D_CHUNK_CACHE_W0_DEFAULT;
+
+    if (options.accessPattern.has_value() && !chunkDims.empty()) {
+        // Number of chunks which have to stay in the cache so that each chunk
+        // is only read once during a sweep.
+        size_t cachedChunks = 1;
+        for (size_t i = 0; i < dims.size(); ++i) {
+            const size_t numChunks =
+                std::max<size_t>(1, (dims[i] + chunkDims[i] - 1) / chunkDims[i]);
+            switch (options.accessPattern.value()) {
+            case AccessPattern::RowSweep:
+                cachedChunks *= i == 0 ? 1 : numChunks;
+                break;
+            case AccessPattern::TileSweep:
+                cachedChunks *= std::min<size_t>(2, numChunks);
+                break;
+            }
+        }
+        const size_t chunkBytes =
+            std::accumulate(chunkDims.begin(), chunkDims.end(), typeSize,
+                            std::multiplies<size_t>());
+        cacheBytes = cachedChunks * chunkBytes;
+
+        // HDF5 recommends a prime number of slots about 100 times larger than
+        // the number of chunks fitting into the cache.
+        cacheSlots = std::max<size_t>(521, cachedChunks * 100);
+        auto isPrime = [](const size_t number) {
+            for (size_t divisor = 2; divisor * divisor <= number; ++divisor) {
+                if (number % divisor == 0) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        while (!isPrime(cacheSlots)) {
+            ++cacheSlots;
+        }
+
+        if (options.accessPattern.value() == AccessPattern::RowSweep) {
+            preemption = 1.0;
+        }
+    }
+    cacheSlots = options.cacheSlots.value_or(cacheSlots);
+    cacheBytes = options.cacheBytes.value_or(cacheBytes);
+    preemption = options.preemption.value_or(preemption);
+
+    hid_t dapl_id = H5Pcreate(H5P_DATASET_ACCESS);
+    checkHDF5Ptr(dapl_id, "H5Pcreate");
+    checkHDF5Call(
+        H5Pset_chunk_cache(dapl_id, cacheSlots, cacheBytes, preemption),
+        "H5Pset_chunk_cache");
+    return dapl_id;
+}
+
+PLI::HDF5::DatasetAccessOptions PLI::HDF5::Dataset::accessOptions() const {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::accessOptions");
+    hid_t dapl_id = H5Dget_access_plist(m_id);
+    checkHDF5Ptr(dapl_id, "H5Dget_access_plist");
+    size_t cacheSlots;
+    size_t cacheBytes;
+    double preemption;
+    herr_t status =
+        H5Pget_chunk_cache(dapl_id, &cacheSlots, &cacheBytes, &preemption);
+    checkHDF5Call(H5Pclose(dapl_id), "H5Pclose");
+    checkHDF5Call(status, "H5Pget_chunk_cache");
+
+    DatasetAccessOptions options;
+    options.cacheSlots = cacheSlots;
+    options.cacheBytes = cacheBytes;
+    options.preemption = preemption;
+    return options;
 }
 
 bool PLI::HDF5::Dataset::exists(const Folder &parentPtr,
@@ -67,13 +187,7 @@ bool PLI::HDF5::Dataset::exists(const Folder &parentPtr,
 
 bool PLI::HDF5::Dataset::isChunked() const {
     checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::isChunked");
-    hid_t plist = H5Dget_create_plist(m_id);
-    if (plist == H5I_INVALID_HID) {
-        return false;
-    }
-    H5D_layout_t layout = H5Pget_layout(plist);
-    checkHDF5Ptr(plist, "H5Pget_layout");
-    return layout == H5D_CHUNKED;
+    return this->metadata().chunked;
 }
 
 std::vector<size_t> PLI::HDF5::Dataset::chunkDims() const {
@@ -81,13 +195,7 @@ std::vector<size_t> PLI::HDF5::Dataset::chunkDims() const {
         throw PLI::HDF5::Exceptions::HDF5RuntimeException(
             "PLI::HDF5::Dataset::chunkDims: Dataset is not chunked.");
     }
-    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::chunkDims");
-    hid_t plist = H5Dget_create_plist(m_id);
-    checkHDF5Ptr(plist, "H5Dget_create_plist");
-    std::vector<hsize_t> _chunkDims(this->ndims());
-    checkHDF5Call(H5Pget_chunk(plist, this->ndims(), _chunkDims.data()),
-                  "H5Pget_chunk");
-    return std::vector<size_t>(_chunkDims.begin(), _chunkDims.end());
+    return this->metadata().chunkDims;
 }
 
 void PLI::HDF5::Dataset::create(const Folder &parentPtr,
@@ -95,11 +203,77 @@ void PLI::HDF5::Dataset::create(const Folder &parentPtr,
                                 const std::vector<size_t> &dims,
                                 const std::vector<size_t> &chunkDims,
                                 const PLI::HDF5::Type &dataType) {
+    DatasetCreateOptions options;
+    options.chunkDims = chunkDims;
+    this->create(parentPtr, datasetName, dims, options, dataType);
+}
+
+void PLI::HDF5::Dataset::create(const Folder &parentPtr,
+                                const std::string &datasetName,
+                                const std::vector<size_t> &dims,
+                                std::initializer_list<size_t> chunkDims,
+                                const PLI::HDF5::Type &dataType) {
+    this->create(parentPtr, datasetName, dims, std::vector<size_t>(chunkDims),
+                 dataType);
+}
+
+void PLI::HDF5::Dataset::create(const Folder &parentPtr,
+                                const std::string &datasetName,
+                                const std::vector<size_t> &dims,
+                                const DatasetCreateOptions &options,
+                                const PLI::HDF5::Type &dataType) {
     std::vector<hsize_t> _dims(dims.begin(), dims.end());
     if (PLI::HDF5::Dataset::exists(parentPtr, datasetName)) {
         throw Exceptions::DatasetExistsException("Dataset already exists!");
     }
 
+    std::vector<hsize_t> _maxDims(_dims);
+    if (!options.maxDims.empty()) {
+        if (dims.size() != options.maxDims.size()) {
+            throw Exceptions::HDF5RuntimeException(
+                "Maximum dimensions must have the same size as "
+                "dataset dimensions.");
+        }
+        for (size_t i = 0; i < dims.size(); i++) {
+            if (options.maxDims[i] < dims[i]) {
+                throw Exceptions::HDF5RuntimeException(
+                    "Maximum dimensions must not be smaller than dataset "
+                    "dimensions.");
+            }
+            _maxDims[i] = options.maxDims[i] == UNLIMITED ? H5S_UNLIMITED
+                                                          : options.maxDims[i];
+        }
+    }
+
+    std::vector<size_t> chunkDims = options.chunkDims;
+    if (chunkDims.empty() && options.chunkPolicy.has_value()) {
+        int numProcesses = 1;
+        if (parentPtr.communicator().has_value()) {
+            MPI_Comm_size(parentPtr.communicator().value(), &numProcesses);
+        }
+        chunkDims = autoChunkDims(dims, dataType, options.chunkPolicy.value(),
+                                  numProcesses);
+    }
+    const bool useFilters = options.shuffle != Shuffle::None ||
+                            options.compression != Compression::None ||
+                            options.fletcher32;
+    if (useFilters && chunkDims.empty()) {
+        throw Exceptions::HDF5RuntimeException(
+            "Filters can only be applied to chunked datasets.");
+    }
+    if (_maxDims != _dims && chunkDims.empty()) {
+        throw Exceptions::HDF5RuntimeException(
+            "Only chunked datasets can be extended.");
+    }
+    if (!filterAvailable(options.shuffle)) {
+        throw Exceptions::FilterNotAvailableException(
+            "Requested shuffle filter is not available.");
+    }
+    if (!filterAvailable(options.compression)) {
+        throw Exceptions::FilterNotAvailableException(
+            "Requested compression filter is not available.");
+    }
+
     hid_t dcpl_id = H5P_DEFAULT;
     if (!chunkDims.empty()) {
         if (dims.size() != chunkDims.size()) {
@@ -109,7 +283,7 @@ void PLI::HDF5::Dataset::create(const Folder &parentPtr,
         }
 
         for (size_t i = 0; i < dims.size(); i++) {
-            if (dims[i] < chunkDims[i]) {
+            if (_maxDims[i] < chunkDims[i]) {
                 throw Exceptions::HDF5RuntimeException(
                     "Chunk dimensions must be smaller than dataset "
                     "dimensions.");
@@ -123,83 +297,1137 @@ void PLI::HDF5::Dataset::create(const Folder &parentPtr,
             H5Pset_chunk(dcpl_id, _chunkDims.size(), _chunkDims.data()),
             "H5Pset_chunk");
         checkHDF5Call(H5Pset_fill_value(dcpl_id, dataType, 0));
-        // Disabled because of issues with H5FD_MPIO_INDEPENDENT
-        // checkHDF5Call(H5Pset_fletcher32(dcpl_id), "H5Pset_fletcher32");
+        setFilters(dcpl_id, options);
     }
 
-    hid_t dataspacePtr = H5Screate_simple(_dims.size(), _dims.data(), nullptr);
+    hid_t dataspacePtr =
+        H5Screate_simple(_dims.size(), _dims.data(), _maxDims.data());
     checkHDF5Ptr(dataspacePtr, "H5Screate_simple");
+    hid_t dapl_id = createAccessPlist(options.access, dims, chunkDims,
+                                      H5Tget_size(dataType));
     hid_t datasetPtr =
         H5Dcreate(parentPtr, datasetName.c_str(), dataType, dataspacePtr,
-                  H5P_DEFAULT, dcpl_id, H5P_DEFAULT);
+                  H5P_DEFAULT, dcpl_id, dapl_id);
     checkHDF5Ptr(datasetPtr, "H5Dcreate");
     checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+    checkHDF5Call(H5Pclose(dapl_id), "H5Pclose");
+    if (dcpl_id != H5P_DEFAULT) {
+        checkHDF5Call(H5Pclose(dcpl_id), "H5Pclose");
+    }
 
     this->m_id = datasetPtr;
     this->m_communicator = parentPtr.communicator();
+    this->m_transferMode = parentPtr.transferMode();
+    this->resetMetadata();
+}
+
+std::vector<size_t>
+PLI::HDF5::Dataset::autoChunkDims(const std::vector<size_t> &dims,
+                                  const PLI::HDF5::Type &dataType,
+                                  const ChunkPolicy &policy,
+                                  const int numProcesses) {
+    std::vector<size_t> chunkDims(dims.size(), 1);
+    if (dims.empty()) {
+        return chunkDims;
+    }
+    const size_t typeSize = std::max<size_t>(1, H5Tget_size(dataType));
+    // Number of elements which may still be distributed.
+    size_t budget = std::max<size_t>(1, policy.targetBytes / typeSize);
+    auto assign = [&](const size_t index, const size_t size) {
+        chunkDims[index] =
+            std::clamp<size_t>(size, 1, std::max<size_t>(1, dims[index]));
+        budget = std::max<size_t>(1, budget / chunkDims[index]);
+    };
+
+    if (policy.profile == ChunkProfile::ZColumn) {
+        for (size_t i = 2; i < dims.size(); ++i) {
+            assign(i, budget);
+        }
+    }
+    if (dims.size() == 1) {
+        assign(0, budget);
+    } else if (policy.profile == ChunkProfile::RowScan) {
+        assign(1, budget);
+        assign(0, budget);
+    } else {
+        // Square area in the image plane. If one side is limited by the
+        // dataset, the other side gets the remaining budget.
+        const size_t side = static_cast<size_t>(std::sqrt(budget));
+        const size_t planeBudget = budget;
+        assign(0, side);
+        assign(1, budget);
+        budget = planeBudget;
+        assign(0, planeBudget / chunkDims[1]);
+    }
+
+    // Leave at least one row of chunks for each process.
+    if (numProcesses > 1) {
+        const size_t rowsPerProcess =
+            (dims[0] + numProcesses - 1) / static_cast<size_t>(numProcesses);
+        chunkDims[0] = std::max<size_t>(
+            1, std::min<size_t>(chunkDims[0], rowsPerProcess));
+    }
+    return chunkDims;
+}
+
+void PLI::HDF5::Dataset::setFilters(const hid_t dcpl_id,
+                                    const DatasetCreateOptions &options) {
+    switch (options.shuffle) {
+    case Shuffle::None:
+        break;
+    case Shuffle::Byte:
+        checkHDF5Call(H5Pset_shuffle(dcpl_id), "H5Pset_shuffle");
+        break;
+    case Shuffle::Bit:
+        // The bitshuffle plugin fills its reserved parameters itself. Without
+        // further parameters, the block size is chosen automatically.
+        checkHDF5Call(H5Pset_filter(dcpl_id, BITSHUFFLE_FILTER,
+                                    H5Z_FLAG_MANDATORY, 0, nullptr),
+                      "H5Pset_filter");
+        break;
+    }
+
+    switch (options.compression) {
+    case Compression::None:
+        break;
+    case Compression::Deflate:
+        checkHDF5Call(
+            H5Pset_deflate(dcpl_id, options.compressionLevel.value_or(4)),
+            "H5Pset_deflate");
+        break;
+    case Compression::SZip:
+        checkHDF5Call(H5Pset_szip(dcpl_id, H5_SZIP_NN_OPTION_MASK,
+                                  options.compressionLevel.value_or(16)),
+                      "H5Pset_szip");
+        break;
+    case Compression::Zstd: {
+        const unsigned level = options.compressionLevel.value_or(3);
+        checkHDF5Call(
+            H5Pset_filter(dcpl_id, ZSTD_FILTER, H5Z_FLAG_MANDATORY, 1, &level),
+            "H5Pset_filter");
+        break;
+    }
+    case Compression::LZ4: {
+        const unsigned blockSize = options.compressionLevel.value_or(0);
+        checkHDF5Call(H5Pset_filter(dcpl_id, LZ4_FILTER, H5Z_FLAG_MANDATORY,
+                                    1, &blockSize),
+                      "H5Pset_filter");
+        break;
+    }
+    }
+
+    if (options.fletcher32) {
+        checkHDF5Call(H5Pset_fletcher32(dcpl_id), "H5Pset_fletcher32");
+    }
+}
+
+bool PLI::HDF5::Dataset::filterAvailable(const H5Z_filter_t filter) {
+    htri_t available;
+    unsigned int config = 0;
+    herr_t infoStatus = -1;
+    // Plugins are loaded on demand. Missing plugins push errors on the HDF5
+    // error stack, which should not be printed here.
+    H5E_BEGIN_TRY {
+        available = H5Zfilter_avail(filter);
+        if (available > 0) {
+            infoStatus = H5Zget_filter_info(filter, &config);
+        }
+    }
+    H5E_END_TRY;
+    return available > 0 && infoStatus >= 0 &&
+           (config & H5Z_FILTER_CONFIG_ENCODE_ENABLED);
+}
+
+bool PLI::HDF5::Dataset::filterAvailable(const Compression compression) {
+    switch (compression) {
+    case Compression::None:
+        return true;
+    case Compression::Deflate:
+        return filterAvailable(H5Z_FILTER_DEFLATE);
+    case Compression::SZip:
+        return filterAvailable(H5Z_FILTER_SZIP);
+    case Compression::Zstd:
+        return filterAvailable(ZSTD_FILTER);
+    case Compression::LZ4:
+        return filterAvailable(LZ4_FILTER);
+    }
+    return false;
+}
+
+bool PLI::HDF5::Dataset::filterAvailable(const Shuffle shuffle) {
+    switch (shuffle) {
+    case Shuffle::None:
+        return true;
+    case Shuffle::Byte:
+        return filterAvailable(H5Z_FILTER_SHUFFLE);
+    case Shuffle::Bit:
+        return filterAvailable(BITSHUFFLE_FILTER);
+    }
+    return false;
+}
+
+std::vector<std::string> PLI::HDF5::Dataset::filters() const {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::filters");
+    hid_t plist = H5Dget_create_plist(m_id);
+    checkHDF5Ptr(plist, "H5Dget_create_plist");
+    int numFilters = H5Pget_nfilters(plist);
+    if (numFilters < 0) {
+        H5Pclose(plist);
+        checkHDF5Call(numFilters, "H5Pget_nfilters");
+    }
+
+    std::vector<std::string> filterNames;
+    for (int i = 0; i < numFilters; ++i) {
+        unsigned int flags;
+        size_t numValues = 0;
+        unsigned int config;
+        char name[256] = {};
+        H5Z_filter_t filter =
+            H5Pget_filter(plist, i, &flags, &numValues, nullptr, sizeof(name),
+                          name, &config);
+        if (filter < 0) {
+            H5Pclose(plist);
+            checkHDF5Call(filter, "H5Pget_filter");
+        }
+        filterNames.emplace_back(name);
+    }
+    checkHDF5Call(H5Pclose(plist), "H5Pclose");
+    return filterNames;
+}
+
+PLI::HDF5::DatasetCreateOptions PLI::HDF5::Dataset::createOptions() const {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::createOptions");
+    DatasetCreateOptions options;
+    if (!this->isChunked()) {
+        return options;
+    }
+    options.chunkDims = this->chunkDims();
+    if (this->maxDims() != this->dims()) {
+        options.maxDims = this->maxDims();
+    }
+
+    hid_t plist = H5Dget_create_plist(m_id);
+    checkHDF5Ptr(plist, "H5Dget_create_plist");
+    const int numFilters = H5Pget_nfilters(plist);
+    for (int i = 0; i < numFilters; ++i) {
+        unsigned int flags;
+        unsigned int config;
+        size_t numValues = 0;
+        // Query the number of parameters first.
+        H5Z_filter_t filter = H5Pget_filter(plist, i, &flags, &numValues,
+                                            nullptr, 0, nullptr, &config);
+        std::vector<unsigned int> values(numValues);
+        if (filter >= 0) {
+            filter = H5Pget_filter(plist, i, &flags, &numValues, values.data(),
+                                   0, nullptr, &config);
+        }
+        if (filter < 0) {
+            H5Pclose(plist);
+            checkHDF5Call(filter, "H5Pget_filter");
+        }
+
+        // The level of a compression filter is its first parameter, except
+        // for SZIP which stores the option mask first.
+        const auto level = [&values](const size_t index) {
+            return index < values.size()
+                       ? std::optional<unsigned>(values[index])
+                       : std::nullopt;
+        };
+        // The parameters added by HDF5 or a plugin when creating the dataset,
+        // e.g. the element size, are derived again for the new dataset.
+        switch (filter) {
+        case H5Z_FILTER_SHUFFLE:
+            options.shuffle = Shuffle::Byte;
+            break;
+        case BITSHUFFLE_FILTER:
+            // The fifth parameter selects the built-in compression of the
+            // plugin, which has no counterpart in the options.
+            if (values.size() < 5 || values[4] == 0) {
+                options.shuffle = Shuffle::Bit;
+            }
+            break;
+        case H5Z_FILTER_FLETCHER32:
+            options.fletcher32 = true;
+            break;
+        case H5Z_FILTER_DEFLATE:
+            options.compression = Compression::Deflate;
+            options.compressionLevel = level(0);
+            break;
+        case H5Z_FILTER_SZIP:
+            options.compression = Compression::SZip;
+            options.compressionLevel = level(1);
+            break;
+        case ZSTD_FILTER:
+            options.compression = Compression::Zstd;
+            options.compressionLevel = level(0);
+            break;
+        case LZ4_FILTER:
+            options.compression = Compression::LZ4;
+            options.compressionLevel = level(0);
+            break;
+        default:
+            break;
+        }
+    }
+    checkHDF5Call(H5Pclose(plist), "H5Pclose");
+    checkHDF5Call(numFilters, "H5Pget_nfilters");
+    return options;
 }
 
 void PLI::HDF5::Dataset::write(const void *data,
                                const std::vector<size_t> &offset,
                                const std::vector<size_t> &dims,
                                const std::vector<size_t> &stride,
-                               const PLI::HDF5::Type &type) {
-    std::vector<hsize_t> _dims(dims.begin(), dims.end());
-    std::vector<hsize_t> _offset(offset.begin(), offset.end());
-    std::vector<hsize_t> _stride(offset.size(), 1);
-    if (!stride.empty()) {
-        _stride = std::vector<hsize_t>(stride.begin(), stride.end());
-    }
+                               const PLI::HDF5::Type &type,
+                               const std::optional<TransferMode> transferMode) {
+    this->write(data, Hyperslab(offset, dims, stride), type, transferMode);
+}
 
-    if (offset.size() != dims.size()) {
-        throw Exceptions::HDF5RuntimeException(
-            "Offset dimensions must have the same size as "
-            "dims dimensions.");
-    }
+void PLI::HDF5::Dataset::write(const void *data,
+                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+                               const PLI::HDF5::Type &type,
+                               const std::optional<TransferMode> transferMode) {
+    const Hyperslab::Extent &count = hyperslab.count();
 
     hid_t dataSpacePtr = H5Dget_space(this->m_id);
     checkHDF5Ptr(dataSpacePtr, "H5Dget_space");
 
-    hid_t xf_id = createXfID();
-    checkHDF5Call(H5Sselect_hyperslab(dataSpacePtr, H5S_SELECT_SET,
-                                      _offset.data(), _stride.data(),
-                                      _dims.data(), nullptr),
-                  "H5Sselect_hyperslab");
-
-    hid_t memspacePtr = H5Screate_simple(_dims.size(), _dims.data(), nullptr);
+    hid_t xf_id = transferPlist(transferMode);
+    hid_t memspacePtr = H5Screate_simple(count.size(), count.data(), nullptr);
     checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+    selectHyperslab(dataSpacePtr, memspacePtr, hyperslab);
     checkHDF5Call(
         H5Dwrite(this->m_id, type, memspacePtr, dataSpacePtr, xf_id, data),
         "H5Dwrite");
 
-    checkHDF5Call(H5Pclose(xf_id), "H5Pclose");
     checkHDF5Call(H5Sclose(dataSpacePtr), "H5Sclose");
+    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
 }
 
-void PLI::HDF5::Dataset::write(const void *data,
-                               const PLI::HDF5::Dataset::Hyperslab &hyperslab,
-                               const PLI::HDF5::Type &type) {
-    this->write(data, hyperslab.offset(), hyperslab.count(), hyperslab.stride(),
-                type);
+void PLI::HDF5::Dataset::read(
+    void *const data, const std::vector<size_t> &offset,
+    const std::vector<size_t> &count, const std::vector<size_t> &stride,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    this->read(data, Hyperslab(offset, count, stride), type, transferMode);
+}
+
+void PLI::HDF5::Dataset::read(
+    void *const data, const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    // Offset, count and stride of the hyperslab are already stored as hsize_t
+    // and can be passed to H5Sselect_hyperslab directly.
+    const Hyperslab::Extent &count = hyperslab.count();
+    size_t numElements = std::accumulate(count.begin(), count.end(), 1ull,
+                                         std::multiplies<std::size_t>());
+    // Check for possible error with MPI because too many elements are requested
+    // to be read at once. Throw an error message for the user and request to
+    // use chunk iterators instead.
+    if (this->m_communicator.has_value() &&
+        numElements > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw PLI::HDF5::Exceptions::DatasetOperationOverflowException(
+            "The requested amount of elements read is not allowed when using "
+            "MPI! Consider using chunk iterators or read the dataset in "
+            "selected amounts.");
+    }
+
+    checkHDF5Ptr(this->m_id, "Dataset ID");
+    hid_t dataspacePtr = H5Dget_space(this->m_id);
+    checkHDF5Ptr(dataspacePtr, "H5Dget_space");
+    hid_t memspacePtr = H5Screate_simple(count.size(), count.data(), nullptr);
+    checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+
+    hid_t xf_id = transferPlist(transferMode);
+    selectHyperslab(dataspacePtr, memspacePtr, hyperslab);
+    checkHDF5Call(
+        H5Dread(this->m_id, type, memspacePtr, dataspacePtr, xf_id, data),
+        "H5Dread");
+
+    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
+    checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+}
+
+void PLI::HDF5::Dataset::readMany(
+    std::span<const PLI::HDF5::Dataset::Hyperslab> hyperslabs,
+    std::span<void *const> outputs, const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::readMany");
+    if (outputs.size() != hyperslabs.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Number of buffers does not match the number of hyperslabs.");
+    }
+    const std::vector<size_t> _dims = this->dims();
+    for (const Hyperslab &hyperslab : hyperslabs) {
+        const Hyperslab::Extent &offset = hyperslab.offset();
+        const Hyperslab::Extent &count = hyperslab.count();
+        const Hyperslab::Extent &stride = hyperslab.stride();
+        if (offset.size() != _dims.size() || count.size() != _dims.size() ||
+            (!stride.empty() && stride.size() != _dims.size())) {
+            throw Exceptions::DimensionMismatchException(
+                "Hyperslab dimensions must have the same size as dataset "
+                "dimensions.");
+        }
+        for (size_t i = 0; i < _dims.size(); ++i) {
+            const size_t step = stride.empty() ? 1 : stride[i];
+            if (count[i] > 0 && offset[i] + (count[i] - 1) * step >= _dims[i]) {
+                throw Exceptions::DimensionMismatchException(
+                    "Hyperslab exceeds the dataset dimensions.");
+            }
+        }
+    }
+
+    // Order the hyperslabs by the chunk of their first element, so that each
+    // batch covers neighbouring chunks.
+    const std::vector<size_t> blockDims =
+        this->isChunked() ? this->chunkDims() : _dims;
+    std::vector<size_t> chunkIndex(hyperslabs.size(), 0);
+    for (size_t i = 0; i < hyperslabs.size(); ++i) {
+        for (size_t j = 0; j < _dims.size(); ++j) {
+            const size_t block = std::max<size_t>(1, blockDims[j]);
+            const size_t numBlocks =
+                std::max<size_t>(1, (_dims[j] + block - 1) / block);
+            chunkIndex[i] =
+                chunkIndex[i] * numBlocks + hyperslabs[i].offset()[j] / block;
+        }
+    }
+    std::vector<size_t> order(hyperslabs.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::stable_sort(order.begin(), order.end(),
+                     [&chunkIndex](const size_t lhs, const size_t rhs) {
+                         return chunkIndex[lhs] < chunkIndex[rhs];
+                     });
+
+    const size_t elementSize = H5Tget_size(type);
+    std::vector<std::vector<size_t>> batches;
+    size_t batchBytes = 0;
+    for (const size_t index : order) {
+        const Hyperslab::Extent &count = hyperslabs[index].count();
+        const size_t bytes =
+            std::accumulate(count.begin(), count.end(), elementSize,
+                            std::multiplies<std::size_t>());
+        if (bytes == 0) {
+            continue;
+        }
+        if (batches.empty() || batchBytes + bytes > READ_MANY_BATCH_BYTES) {
+            batches.emplace_back();
+            batchBytes = 0;
+        }
+        batches.back().push_back(index);
+        batchBytes += bytes;
+    }
+
+    // Collective reads have to be called the same number of times on all
+    // processes. Processes with fewer batches read empty selections.
+    uint64_t numBatches = batches.size();
+    if (m_communicator.has_value() &&
+        transferMode.value_or(m_transferMode) != TransferMode::Independent) {
+        MPI_Allreduce(MPI_IN_PLACE, &numBatches, 1, MPI_UINT64_T, MPI_MAX,
+                      m_communicator.value());
+    }
+    batches.resize(numBatches);
+    for (const std::vector<size_t> &batch : batches) {
+        this->readManyBatch(hyperslabs, outputs, batch, type, transferMode);
+    }
+}
+
+void PLI::HDF5::Dataset::readManyBatch(
+    std::span<const PLI::HDF5::Dataset::Hyperslab> hyperslabs,
+    std::span<void *const> outputs, const std::vector<size_t> &batch,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    const std::vector<size_t> _dims = this->dims();
+    const size_t numDims = _dims.size();
+    const size_t elementSize = H5Tget_size(type);
+
+    // Part of a hyperslab along the last dimension.
+    struct Run {
+        size_t output;
+        size_t outputOffset;
+        size_t start;
+        size_t stride;
+        size_t count;
+    };
+    // Runs of all hyperslabs grouped by the row they are located in. Rows
+    // are ordered as in the file, which is also the order in which HDF5
+    // returns the elements of the combined selection.
+    std::map<size_t, std::vector<Run>> rows;
+
+    hid_t dataspacePtr = H5Dget_space(this->m_id);
+    checkHDF5Ptr(dataspacePtr, "H5Dget_space");
+    herr_t status = H5Sselect_none(dataspacePtr);
+    for (const size_t index : batch) {
+        const Hyperslab &hyperslab = hyperslabs[index];
+        const Hyperslab::Extent &offset = hyperslab.offset();
+        const Hyperslab::Extent &count = hyperslab.count();
+        const Hyperslab::Extent &stride = hyperslab.stride();
+        if (status >= 0) {
+            status = H5Sselect_hyperslab(
+                dataspacePtr,
+                index == batch.front() ? H5S_SELECT_SET : H5S_SELECT_OR,
+                offset.data(), stride.data(), count.data(), nullptr);
+        }
+
+        const size_t rowLength = count[numDims - 1];
+        const size_t numRows =
+            std::accumulate(count.begin(), count.end() - 1, size_t{1},
+                            std::multiplies<std::size_t>());
+        std::vector<size_t> position(numDims - 1, 0);
+        for (size_t row = 0; row < numRows; ++row) {
+            size_t key = 0;
+            for (size_t i = 0; i + 1 < numDims; ++i) {
+                key = key * _dims[i] + offset[i] + position[i] * stride[i];
+            }
+            rows[key].push_back({index, row * rowLength, offset[numDims - 1],
+                                 stride[numDims - 1], rowLength});
+            for (size_t i = numDims - 1; i-- > 0;) {
+                if (++position[i] < count[i]) {
+                    break;
+                }
+                position[i] = 0;
+            }
+        }
+    }
+    if (status < 0) {
+        H5Sclose(dataspacePtr);
+        checkHDF5Call(status, "H5Sselect_hyperslab");
+    }
+
+    // Overlapping hyperslabs share elements in the file selection. Such rows
+    // only hold the union of the columns of their runs.
+    auto unionColumns = [](const std::vector<Run> &runs) {
+        std::vector<size_t> columns;
+        for (const Run &run : runs) {
+            for (size_t i = 0; i < run.count; ++i) {
+                columns.push_back(run.start + i * run.stride);
+            }
+        }
+        std::sort(columns.begin(), columns.end());
+        columns.erase(std::unique(columns.begin(), columns.end()),
+                      columns.end());
+        return columns;
+    };
+    std::vector<size_t> rowOffsets;
+    rowOffsets.reserve(rows.size());
+    size_t numElements = 0;
+    for (const auto &[key, runs] : rows) {
+        rowOffsets.push_back(numElements);
+        numElements +=
+            runs.size() == 1 ? runs.front().count : unionColumns(runs).size();
+    }
+    if (numElements != static_cast<size_t>(std::max<hssize_t>(
+                           0, H5Sget_select_npoints(dataspacePtr)))) {
+        H5Sclose(dataspacePtr);
+        throw Exceptions::HDF5RuntimeException(
+            "PLI::HDF5::Dataset::readMany: Selection does not match the "
+            "requested elements.");
+    }
+
+    const hsize_t memDims = std::max<size_t>(1, numElements);
+    hid_t memspacePtr = H5Screate_simple(1, &memDims, nullptr);
+    checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+    if (numElements == 0) {
+        checkHDF5Call(H5Sselect_none(memspacePtr), "H5Sselect_none");
+    }
+    std::vector<uint8_t, DefaultInitAllocator<uint8_t>> staging(
+        memDims * elementSize);
+    status = H5Dread(this->m_id, type, memspacePtr, dataspacePtr,
+                     transferPlist(transferMode), staging.data());
+    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
+    checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+    checkHDF5Call(status, "H5Dread");
+
+    size_t rowIndex = 0;
+    for (const auto &[key, runs] : rows) {
+        const uint8_t *row =
+            staging.data() + rowOffsets[rowIndex++] * elementSize;
+        if (runs.size() == 1) {
+            const Run &run = runs.front();
+            std::memcpy(static_cast<uint8_t *>(outputs[run.output]) +
+                            run.outputOffset * elementSize,
+                        row, run.count * elementSize);
+            continue;
+        }
+        const std::vector<size_t> columns = unionColumns(runs);
+        for (const Run &run : runs) {
+            uint8_t *target = static_cast<uint8_t *>(outputs[run.output]) +
+                              run.outputOffset * elementSize;
+            size_t position = std::lower_bound(columns.begin(), columns.end(),
+                                               run.start) -
+                              columns.begin();
+            for (size_t i = 0; i < run.count; ++i) {
+                const size_t column = run.start + i * run.stride;
+                while (columns[position] != column) {
+                    ++position;
+                }
+                std::memcpy(target + i * elementSize,
+                            row + position * elementSize, elementSize);
+            }
+        }
+    }
+}
+
+void PLI::HDF5::Dataset::readPoints(
+    void *const data, std::span<const size_t> coordinates,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::readPoints");
+    const std::vector<size_t> _dims = this->dims();
+    const size_t numDims = _dims.size();
+    if (coordinates.size() % numDims != 0) {
+        throw Exceptions::DimensionMismatchException(
+            "Number of coordinates must be a multiple of the number of "
+            "dataset dimensions.");
+    }
+    const size_t numPoints = coordinates.size() / numDims;
+    if (this->m_communicator.has_value() &&
+        numPoints > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw PLI::HDF5::Exceptions::DatasetOperationOverflowException(
+            "The requested amount of elements read is not allowed when using "
+            "MPI! Consider reading the points in smaller batches.");
+    }
+
+    // Sort the points by the chunk they are located in and by their position
+    // in the dataset. HDF5 reads point selections in the given order, so
+    // this visits each chunk once.
+    const std::vector<size_t> blockDims =
+        this->isChunked() ? this->chunkDims() : _dims;
+    std::vector<std::pair<size_t, size_t>> keys(numPoints);
+    for (size_t point = 0; point < numPoints; ++point) {
+        size_t chunkIndex = 0;
+        size_t linearIndex = 0;
+        for (size_t i = 0; i < numDims; ++i) {
+            const size_t coordinate = coordinates[point * numDims + i];
+            if (coordinate >= _dims[i]) {
+                throw Exceptions::DimensionMismatchException(
+                    "Point exceeds the dataset dimensions.");
+            }
+            const size_t block = std::max<size_t>(1, blockDims[i]);
+            chunkIndex = chunkIndex * ((_dims[i] + block - 1) / block) +
+                         coordinate / block;
+            linearIndex = linearIndex * _dims[i] + coordinate;
+        }
+        keys[point] = {chunkIndex, linearIndex};
+    }
+    std::vector<size_t> order(numPoints);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(),
+              [&keys](const size_t lhs, const size_t rhs) {
+                  return keys[lhs] < keys[rhs];
+              });
+
+    // Duplicate points are selected once. position holds the index of each
+    // sorted point in the selection.
+    std::vector<hsize_t> selection;
+    selection.reserve(coordinates.size());
+    std::vector<size_t> position(numPoints);
+    size_t numSelected = 0;
+    for (size_t i = 0; i < numPoints; ++i) {
+        const size_t point = order[i];
+        if (i == 0 || keys[point] != keys[order[i - 1]]) {
+            selection.insert(selection.end(),
+                             coordinates.begin() + point * numDims,
+                             coordinates.begin() + (point + 1) * numDims);
+            ++numSelected;
+        }
+        position[i] = numSelected - 1;
+    }
+
+    hid_t dataspacePtr = H5Dget_space(this->m_id);
+    checkHDF5Ptr(dataspacePtr, "H5Dget_space");
+    const hsize_t memDims = std::max<size_t>(1, numSelected);
+    hid_t memspacePtr = H5Screate_simple(1, &memDims, nullptr);
+    checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+    herr_t status;
+    if (numSelected == 0) {
+        // Processes without points still take part in collective calls.
+        status = H5Sselect_none(dataspacePtr);
+        if (status >= 0) {
+            status = H5Sselect_none(memspacePtr);
+        }
+    } else {
+        status = H5Sselect_elements(dataspacePtr, H5S_SELECT_SET, numSelected,
+                                    selection.data());
+    }
+    const size_t elementSize = H5Tget_size(type);
+    std::vector<uint8_t, DefaultInitAllocator<uint8_t>> staging(memDims *
+                                                                elementSize);
+    if (status >= 0) {
+        status = H5Dread(this->m_id, type, memspacePtr, dataspacePtr,
+                         transferPlist(transferMode), staging.data());
+    }
+    checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
+    checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+    checkHDF5Call(status, "H5Dread");
+
+    uint8_t *const target = static_cast<uint8_t *>(data);
+    for (size_t i = 0; i < numPoints; ++i) {
+        std::memcpy(target + order[i] * elementSize,
+                    staging.data() + position[i] * elementSize, elementSize);
+    }
+}
+
+void PLI::HDF5::Dataset::readHaloRegion(
+    void *const data, const PLI::HDF5::Dataset::Hyperslab &tile,
+    const std::vector<size_t> &halo, const BoundaryMode boundary,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode, const void *previousData,
+    const PLI::HDF5::Dataset::Hyperslab *previousTile) const {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::readWithHalo");
+    const std::vector<size_t> _dims = this->dims();
+    const size_t numDims = _dims.size();
+    if (tile.size() != numDims || halo.size() != numDims) {
+        throw Exceptions::DimensionMismatchException(
+            "Tile and halo must have the same size as the dataset "
+            "dimensions.");
+    }
+    for (size_t i = 0; i < numDims; ++i) {
+        if (tile.stride()[i] != 1) {
+            throw Exceptions::DimensionMismatchException(
+                "Tiles read with halo must not have a stride.");
+        }
+        if (tile.offset()[i] + tile.count()[i] > _dims[i]) {
+            throw Exceptions::DimensionMismatchException(
+                "Tile exceeds the dataset dimensions.");
+        }
+    }
+    if (numDims == 0) {
+        return;
+    }
+    const size_t elementSize = H5Tget_size(type);
+    std::byte *const buffer = static_cast<std::byte *>(data);
+
+    // Part of the extended tile inside the dataset, in dataset coordinates.
+    const auto region = [&_dims, &halo, numDims](const Hyperslab &slab) {
+        Hyperslab::Extent begin(numDims, 0);
+        Hyperslab::Extent count(numDims, 0);
+        for (size_t i = 0; i < numDims; ++i) {
+            begin[i] = slab.offset()[i] - std::min<hsize_t>(slab.offset()[i],
+                                                            halo[i]);
+            count[i] = std::min<hsize_t>(slab.offset()[i] + slab.count()[i] +
+                                             halo[i],
+                                         _dims[i]) -
+                       begin[i];
+        }
+        return Hyperslab(begin, count);
+    };
+    // Dimensions of the extended tile in memory.
+    const auto paddedDims = [&halo, numDims](const Hyperslab &slab) {
+        Hyperslab::Extent dims(numDims, 0);
+        for (size_t i = 0; i < numDims; ++i) {
+            dims[i] = slab.count()[i] + 2 * halo[i];
+        }
+        return dims;
+    };
+    // Position of an element of the dataset in the extended tile.
+    const auto memoryOffset = [&halo, numDims](const Hyperslab &slab,
+                                               const Hyperslab::Extent &at) {
+        Hyperslab::Extent offset(numDims, 0);
+        for (size_t i = 0; i < numDims; ++i) {
+            offset[i] = at[i] + halo[i] - slab.offset()[i];
+        }
+        return offset;
+    };
+    const Hyperslab::Extent _paddedDims = paddedDims(tile);
+
+    const auto readBox = [&](const Hyperslab &box) {
+        hid_t dataspacePtr = H5Dget_space(this->m_id);
+        checkHDF5Ptr(dataspacePtr, "H5Dget_space");
+        hid_t memspacePtr =
+            H5Screate_simple(numDims, _paddedDims.data(), nullptr);
+        checkHDF5Ptr(memspacePtr, "H5Screate_simple");
+        selectHyperslab(dataspacePtr, memspacePtr, box);
+        const Hyperslab::Extent &count = box.count();
+        if (std::find(count.begin(), count.end(), 0) == count.end()) {
+            checkHDF5Call(H5Sselect_hyperslab(
+                              memspacePtr, H5S_SELECT_SET,
+                              memoryOffset(tile, box.offset()).data(),
+                              nullptr, count.data(), nullptr),
+                          "H5Sselect_hyperslab");
+        }
+        hid_t xf_id = transferPlist(transferMode);
+        checkHDF5Call(H5Dread(this->m_id, type, memspacePtr, dataspacePtr,
+                              xf_id, data),
+                      "H5Dread");
+        checkHDF5Call(H5Sclose(memspacePtr), "H5Sclose");
+        checkHDF5Call(H5Sclose(dataspacePtr), "H5Sclose");
+    };
+
+    const Hyperslab current = region(tile);
+    bool reused = false;
+    if (previousData != nullptr && previousTile != nullptr &&
+        previousTile->size() == numDims) {
+        // Neighbouring tiles along one dimension share a box of elements.
+        const Hyperslab previous = region(*previousTile);
+        size_t dim = 0;
+        size_t numDiffering = 0;
+        for (size_t i = 0; i < numDims; ++i) {
+            if (previous.offset()[i] != current.offset()[i] ||
+                previous.count()[i] != current.count()[i]) {
+                dim = i;
+                ++numDiffering;
+            }
+        }
+        const hsize_t begin =
+            std::max(current.offset()[dim], previous.offset()[dim]);
+        const hsize_t end =
+            std::min(current.offset()[dim] + current.count()[dim],
+                     previous.offset()[dim] + previous.count()[dim]);
+        if (numDiffering == 1 && begin < end) {
+            Hyperslab::Extent offset = current.offset();
+            Hyperslab::Extent count = current.count();
+            offset[dim] = begin;
+            count[dim] = end - begin;
+
+            // Copy the shared box row by row from the previous buffer.
+            const Hyperslab::Extent dstDims = _paddedDims;
+            const Hyperslab::Extent srcDims = paddedDims(*previousTile);
+            const Hyperslab::Extent dstOffset = memoryOffset(tile, offset);
+            const Hyperslab::Extent srcOffset =
+                memoryOffset(*previousTile, offset);
+            const std::byte *const source =
+                static_cast<const std::byte *>(previousData);
+            const size_t rowBytes = count[numDims - 1] * elementSize;
+            const size_t numRows =
+                std::accumulate(count.begin(), count.end() - 1, size_t{1},
+                                std::multiplies<std::size_t>());
+            std::vector<size_t> position(numDims, 0);
+            for (size_t row = 0; row < numRows; ++row) {
+                size_t dstIndex = 0;
+                size_t srcIndex = 0;
+                for (size_t i = 0; i < numDims; ++i) {
+                    dstIndex =
+                        dstIndex * dstDims[i] + dstOffset[i] + position[i];
+                    srcIndex =
+                        srcIndex * srcDims[i] + srcOffset[i] + position[i];
+                }
+                std::memcpy(buffer + dstIndex * elementSize,
+                            source + srcIndex * elementSize, rowBytes);
+                for (size_t i = numDims - 1; i-- > 0;) {
+                    if (++position[i] < count[i]) {
+                        break;
+                    }
+                    position[i] = 0;
+                }
+            }
+
+            // Read the remaining parts before and after the shared box.
+            if (current.offset()[dim] < begin) {
+                Hyperslab::Extent before = current.count();
+                before[dim] = begin - current.offset()[dim];
+                readBox(Hyperslab(current.offset(), before));
+            }
+            if (end < current.offset()[dim] + current.count()[dim]) {
+                Hyperslab::Extent after = current.offset();
+                Hyperslab::Extent afterCount = current.count();
+                after[dim] = end;
+                afterCount[dim] =
+                    current.offset()[dim] + current.count()[dim] - end;
+                readBox(Hyperslab(after, afterCount));
+            }
+            reused = true;
+        }
+    }
+    if (!reused) {
+        readBox(current);
+    }
+    if (boundary == BoundaryMode::Constant) {
+        return;
+    }
+
+    // Fill the border one dimension after the other by copying whole
+    // hyperplanes. Later dimensions copy the already filled borders of the
+    // earlier ones, which fills the corners.
+    const Hyperslab::Extent valid = memoryOffset(tile, current.offset());
+    for (size_t dim = 0; dim < numDims; ++dim) {
+        const size_t length = _paddedDims[dim];
+        const size_t lower = valid[dim];
+        const size_t upper = lower + current.count()[dim];
+        if (upper == lower || (lower == 0 && upper == length)) {
+            continue;
+        }
+        const size_t outer =
+            std::accumulate(_paddedDims.begin(), _paddedDims.begin() + dim,
+                            size_t{1}, std::multiplies<std::size_t>());
+        const size_t planeBytes =
+            std::accumulate(_paddedDims.begin() + dim + 1, _paddedDims.end(),
+                            elementSize, std::multiplies<std::size_t>());
+        const auto source = [boundary, lower, upper](const size_t index) {
+            const auto distance = static_cast<std::ptrdiff_t>(index) -
+                                  static_cast<std::ptrdiff_t>(lower);
+            const auto size = static_cast<std::ptrdiff_t>(upper - lower);
+            if (boundary == BoundaryMode::Clamp || size == 1) {
+                return lower + static_cast<size_t>(
+                                   std::clamp<std::ptrdiff_t>(distance, 0,
+                                                              size - 1));
+            }
+            const std::ptrdiff_t period = 2 * (size - 1);
+            std::ptrdiff_t mirrored = ((distance % period) + period) % period;
+            if (mirrored >= size) {
+                mirrored = period - mirrored;
+            }
+            return lower + static_cast<size_t>(mirrored);
+        };
+        for (size_t o = 0; o < outer; ++o) {
+            std::byte *const planes = buffer + o * length * planeBytes;
+            for (size_t index = 0; index < length; ++index) {
+                if (index == lower) {
+                    index = upper;
+                    if (index >= length) {
+                        break;
+                    }
+                }
+                std::memcpy(planes + index * planeBytes,
+                            planes + source(index) * planeBytes, planeBytes);
+            }
+        }
+    }
+}
+
+bool PLI::HDF5::Dataset::mapRegion(PLI::HDF5::MappedRegion &region,
+                                   const PLI::HDF5::Type &type,
+                                   const size_t alignment,
+                                   const MapAdvice advice) const {
+    // MPI-IO files may be striped over several storage targets, mapping them
+    // on each process would bypass MPI-IO.
+    if (this->m_communicator.has_value()) {
+        return false;
+    }
+    // The raw data has to be stored in one piece inside of the HDF5 file
+    // with the same representation as in memory.
+    if (H5Tequal(this->metadata().typeID, type) <= 0) {
+        return false;
+    }
+    hid_t plist = H5Dget_create_plist(this->m_id);
+    checkHDF5Ptr(plist, "H5Dget_create_plist");
+    const bool contiguous = H5Pget_layout(plist) == H5D_CONTIGUOUS &&
+                            H5Pget_external_count(plist) == 0;
+    checkHDF5Call(H5Pclose(plist), "H5Pclose");
+    if (!contiguous) {
+        return false;
+    }
+    hid_t fileID = H5Iget_file_id(this->m_id);
+    checkHDF5Ptr(fileID, "H5Iget_file_id");
+    hid_t fapl = H5Fget_access_plist(fileID);
+    const bool singleFile = fapl >= 0 && H5Pget_driver(fapl) == H5FD_SEC2;
+    if (fapl >= 0) {
+        H5Pclose(fapl);
+    }
+    std::string fileName;
+    herr_t status = 0;
+    if (singleFile) {
+        // Pending raw data may still reside in the sieve buffer.
+        status = H5Fflush(fileID, H5F_SCOPE_LOCAL);
+        const ssize_t nameLength = H5Fget_name(fileID, nullptr, 0);
+        fileName.resize(std::max<ssize_t>(nameLength, 0));
+        if (nameLength > 0) {
+            H5Fget_name(fileID, fileName.data(), nameLength + 1);
+        }
+    }
+    checkHDF5Call(H5Fclose(fileID), "H5Fclose");
+    checkHDF5Call(status, "H5Fflush");
+    if (!singleFile || fileName.empty()) {
+        return false;
+    }
+
+    const haddr_t offset = H5Dget_offset(this->m_id);
+    const std::vector<size_t> _dims = this->dims();
+    const size_t numBytes =
+        std::accumulate(_dims.begin(), _dims.end(), H5Tget_size(type),
+                        std::multiplies<std::size_t>());
+    // Storage is only allocated after the first write.
+    if (offset == HADDR_UNDEF || numBytes == 0 ||
+        H5Dget_storage_size(this->m_id) != numBytes ||
+        offset % alignment != 0) {
+        return false;
+    }
+    return region.map(fileName, offset, numBytes, advice);
+}
+
+PLI::HDF5::Dataset::RawChunk
+PLI::HDF5::Dataset::readRawChunk(const std::vector<size_t> &offset) const {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::readRawChunk");
+    if (offset.size() != static_cast<size_t>(this->ndims())) {
+        throw Exceptions::DimensionMismatchException(
+            "Offset dimensions must have the same size as dataset "
+            "dimensions.");
+    }
+    std::vector<hsize_t> _offset(offset.begin(), offset.end());
+
+    hsize_t chunkBytes = 0;
+    herr_t status;
+    // HDF5 before 1.12 fails instead of returning zero bytes for chunks which
+    // were never written.
+    H5E_BEGIN_TRY {
+        status = H5Dget_chunk_storage_size(m_id, _offset.data(), &chunkBytes);
+    }
+    H5E_END_TRY;
+    if (status < 0) {
+        bool validOffset = this->isChunked();
+        if (validOffset) {
+            const std::vector<size_t> _dims = this->dims();
+            const std::vector<size_t> _chunkDims = this->chunkDims();
+            for (size_t i = 0; i < offset.size(); ++i) {
+                validOffset = validOffset && offset[i] < _dims[i] &&
+                              offset[i] % _chunkDims[i] == 0;
+            }
+        }
+        if (!validOffset) {
+            checkHDF5Call(status, "H5Dget_chunk_storage_size");
+        }
+        chunkBytes = 0;
+    }
+    RawChunk chunk;
+    chunk.data.resize(chunkBytes);
+    if (chunkBytes > 0) {
+        checkHDF5Call(H5Dread_chunk(m_id, H5P_DEFAULT, _offset.data(),
+                                    &chunk.filterMask, chunk.data.data()),
+                      "H5Dread_chunk");
+    }
+    return chunk;
+}
+
+void PLI::HDF5::Dataset::writeRawChunk(const std::vector<size_t> &offset,
+                                       const std::vector<uint8_t> &data,
+                                       const uint32_t filterMask) {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::writeRawChunk");
+    if (offset.size() != static_cast<size_t>(this->ndims())) {
+        throw Exceptions::DimensionMismatchException(
+            "Offset dimensions must have the same size as dataset "
+            "dimensions.");
+    }
+    std::vector<hsize_t> _offset(offset.begin(), offset.end());
+    checkHDF5Call(H5Dwrite_chunk(m_id, H5P_DEFAULT, filterMask, _offset.data(),
+                                 data.size(), data.data()),
+                  "H5Dwrite_chunk");
+}
+
+bool PLI::HDF5::Dataset::copyChunksTo(Dataset &target) const {
+    checkHDF5Ptr(m_id, "PLI::HDF5::Dataset::copyChunksTo");
+    checkHDF5Ptr(target, "PLI::HDF5::Dataset::copyChunksTo");
+    if (this->dims() != target.dims()) {
+        throw Exceptions::DimensionMismatchException(
+            "Datasets must have the same dimensions to copy chunks.");
+    }
+
+    if (canCopyRawChunks(target)) {
+        for (const auto &chunk : this->chunkGrid()) {
+            const RawChunk rawChunk = this->readRawChunk(chunk.offset());
+            // Chunks which were never written stay unallocated.
+            if (!rawChunk.data.empty()) {
+                target.writeRawChunk(chunk.offset(), rawChunk.data,
+                                     rawChunk.filterMask);
+            }
+        }
+        return true;
+    }
+
+    int rank = 0;
+    int size = 1;
+    if (m_communicator.has_value()) {
+        MPI_Comm_rank(m_communicator.value(), &rank);
+        MPI_Comm_size(m_communicator.value(), &size);
+    }
+
+    // Copy along the chunks of the target to write each chunk only once.
+    const ChunkGrid chunks = target.isChunked()
+                                 ? this->chunkGrid(target.chunkDims())
+                                 : this->chunkGrid();
+    const PLI::HDF5::Type dataType(this->metadata().typeID);
+    const size_t typeSize = H5Tget_size(dataType);
+    const Hyperslab emptySelection(std::vector<size_t>(this->ndims(), 0),
+                                   std::vector<size_t>(this->ndims(), 0));
+    // Every process takes part in the same number of calls, so that
+    // collective transfer modes can be used.
+    const size_t rounds = (chunks.size() + size - 1) / size;
+    std::vector<uint8_t> buffer;
+    for (size_t round = 0; round < rounds; ++round) {
+        const size_t index = round * size + rank;
+        const Hyperslab chunk =
+            index < chunks.size() ? chunks[index] : emptySelection;
+        const Hyperslab::Extent &count = chunk.count();
+        buffer.resize(std::accumulate(count.begin(), count.end(), typeSize,
+                                      std::multiplies<size_t>()));
+        this->read(buffer.data(), chunk, dataType);
+        target.write(buffer.data(), chunk, dataType);
+    }
+    return false;
+}
+
+bool PLI::HDF5::Dataset::canCopyRawChunks(const Dataset &target) const {
+    // Raw chunk access is not supported with MPI-IO.
+    if (m_communicator.has_value() || target.m_communicator.has_value()) {
+        return false;
+    }
+    if (!this->isChunked() || !target.isChunked() ||
+        this->chunkDims() != target.chunkDims() ||
+        PLI::HDF5::Type(this->metadata().typeID) !=
+            PLI::HDF5::Type(target.metadata().typeID)) {
+        return false;
+    }
+
+    hid_t plist = H5Dget_create_plist(m_id);
+    checkHDF5Ptr(plist, "H5Dget_create_plist");
+    hid_t targetPlist = H5Dget_create_plist(target);
+    if (targetPlist == H5I_INVALID_HID) {
+        H5Pclose(plist);
+        checkHDF5Ptr(targetPlist, "H5Dget_create_plist");
+    }
+    const bool result = sameFilters(plist, targetPlist);
+    checkHDF5Call(H5Pclose(plist), "H5Pclose");
+    checkHDF5Call(H5Pclose(targetPlist), "H5Pclose");
+    return result;
+}
+
+bool PLI::HDF5::Dataset::sameFilters(const hid_t dcpl_id,
+                                     const hid_t otherDcpl_id) {
+    int numFilters = H5Pget_nfilters(dcpl_id);
+    checkHDF5Call(numFilters, "H5Pget_nfilters");
+    if (numFilters != H5Pget_nfilters(otherDcpl_id)) {
+        return false;
+    }
+
+    for (int i = 0; i < numFilters; ++i) {
+        std::vector<std::vector<unsigned int>> values(2);
+        std::vector<H5Z_filter_t> filters(2);
+        const std::vector<hid_t> plists{dcpl_id, otherDcpl_id};
+        for (size_t j = 0; j < plists.size(); ++j) {
+            unsigned int flags;
+            unsigned int config;
+            size_t numValues = 0;
+            // Query the number of parameters first.
+            checkHDF5Call(H5Pget_filter(plists[j], i, &flags, &numValues,
+                                        nullptr, 0, nullptr, &config),
+                          "H5Pget_filter");
+            values[j].resize(numValues);
+            filters[j] =
+                H5Pget_filter(plists[j], i, &flags, &numValues,
+                              values[j].data(), 0, nullptr, &config);
+            checkHDF5Call(filters[j], "H5Pget_filter");
+        }
+        if (filters[0] != filters[1] || values[0] != values[1]) {
+            return false;
+        }
+    }
+    return true;
 }
 
 const PLI::HDF5::Type PLI::HDF5::Dataset::type() const {
     checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::type");
-    hid_t typePtr = H5Dget_type(this->m_id);
-    checkHDF5Ptr(typePtr, "H5Dget_type");
-    return PLI::HDF5::Type(typePtr);
+    // The cached datatype is closed with the dataset, so the caller gets a
+    // copy.
+    const hid_t typeID = H5Tcopy(this->metadata().typeID);
+    checkHDF5Ptr(typeID, "H5Tcopy");
+    return PLI::HDF5::Type(typeID);
 }
 
 int PLI::HDF5::Dataset::ndims() const {
     if (this->m_id < 0) {
         throw Exceptions::IdentifierNotValidException("Dataset ID is invalid!");
     }
-    hid_t dataspace = H5Dget_space(this->m_id);
-    checkHDF5Ptr(dataspace, "H5Dget_space");
-    int numDims = H5Sget_simple_extent_ndims(dataspace);
-    checkHDF5Call(H5Sclose(dataspace), "H5Sclose");
+    const size_t numDims = this->metadata().dims.size();
     if (numDims > 0) {
-        return numDims;
+        return static_cast<int>(numDims);
     } else {
         throw Exceptions::HDF5RuntimeException("Dataset has no dimensions.");
     }
@@ -207,16 +1435,98 @@ int PLI::HDF5::Dataset::ndims() const {
 
 const std::vector<size_t> PLI::HDF5::Dataset::dims() const {
     checkHDF5Ptr(this->m_id, "Dataset ID");
-    int numDims = this->ndims();
-    std::vector<hsize_t> dims;
-    dims.resize(numDims);
+    return this->metadata().dims;
+}
 
-    hid_t dataspace = H5Dget_space(this->m_id);
-    checkHDF5Ptr(dataspace, "H5Dget_space");
-    H5Sget_simple_extent_dims(dataspace, dims.data(), nullptr);
-    checkHDF5Call(H5Sclose(dataspace), "H5Sclose");
+const std::vector<size_t> PLI::HDF5::Dataset::maxDims() const {
+    checkHDF5Ptr(this->m_id, "Dataset ID");
+    return this->metadata().maxDims;
+}
 
-    return std::vector<size_t>(dims.begin(), dims.end());
+void PLI::HDF5::Dataset::extend(const std::vector<size_t> &newDims) {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::extend");
+    if (newDims.size() != static_cast<size_t>(this->ndims())) {
+        throw Exceptions::DimensionMismatchException(
+            "New dimensions must have the same size as dataset dimensions.");
+    }
+    std::vector<hsize_t> _newDims(newDims.begin(), newDims.end());
+    checkHDF5Call(H5Dset_extent(this->m_id, _newDims.data()), "H5Dset_extent");
+    this->invalidateMetadata();
+}
+
+void PLI::HDF5::Dataset::append(const void *data, const size_t count,
+                                const size_t axis, const PLI::HDF5::Type &type,
+                                const std::optional<TransferMode> transferMode) {
+    const std::vector<size_t> oldDims = this->dims();
+    if (axis >= oldDims.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Axis exceeds the number of dimensions of the dataset.");
+    }
+    std::vector<size_t> newDims = oldDims;
+    newDims[axis] += count;
+    this->extend(newDims);
+
+    std::vector<size_t> offset(oldDims.size(), 0);
+    offset[axis] = oldDims[axis];
+    std::vector<size_t> slab = oldDims;
+    slab[axis] = count;
+    // Every process passes the same data. Only one of them writes it while
+    // the others still take part in collective calls.
+    int rank = 0;
+    if (m_communicator.has_value()) {
+        MPI_Comm_rank(m_communicator.value(), &rank);
+    }
+    if (rank != 0) {
+        std::fill(slab.begin(), slab.end(), 0);
+    }
+    this->write(data, offset, slab, {}, type, transferMode);
+}
+
+PLI::HDF5::IOHandle PLI::HDF5::Dataset::submitAsync(
+    std::function<void(Dataset &)> operation) const {
+    // MPI-IO calls from the I/O thread are only allowed if MPI guarantees
+    // thread safety.
+    bool background = true;
+    if (m_communicator) {
+        int provided;
+        MPI_Query_thread(&provided);
+        background = provided == MPI_THREAD_MULTIPLE;
+    }
+
+    // Writes are only executed in the background if the HDF5 library is
+    // thread-safe, so HDF5 can be used here while earlier writes are pending.
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::writeAsync");
+    const hid_t fileID = H5Iget_file_id(this->m_id);
+    checkHDF5Ptr(fileID, "H5Iget_file_id");
+    // The copy keeps the dataset open until the write is finished.
+    auto dataset = std::make_shared<Dataset>(*this);
+    IOHandle handle;
+    try {
+        handle = IOQueue::getInstance()->submit(
+            fileID,
+            [dataset, operation = std::move(operation)]() {
+                operation(*dataset);
+            },
+            background);
+    } catch (...) {
+        H5Idec_ref(fileID);
+        throw;
+    }
+    // The queue holds its own reference to the file until the write is
+    // finished.
+    checkHDF5Call(H5Idec_ref(fileID), "H5Idec_ref");
+    return handle;
+}
+
+void PLI::HDF5::Dataset::refresh() {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::refresh");
+    checkHDF5Call(H5Drefresh(this->m_id), "H5Drefresh");
+    this->invalidateMetadata();
+}
+
+void PLI::HDF5::Dataset::flush() {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::flush");
+    checkHDF5Call(H5Dflush(this->m_id), "H5Dflush");
 }
 
 PLI::HDF5::Dataset::Dataset() noexcept : Object() {}
@@ -228,37 +1538,176 @@ PLI::HDF5::Dataset::Dataset(
 }
 
 PLI::HDF5::Dataset::Dataset(const Dataset &dataset) noexcept
-    : Object(dataset.id(), dataset.communicator()) {}
+    : Object(dataset.id(), dataset.communicator()),
+      m_metadata(dataset.m_metadata) {
+    this->m_transferMode = dataset.transferMode();
+}
 
 PLI::HDF5::Dataset &
 PLI::HDF5::Dataset::operator=(const Dataset &dataset) noexcept {
     this->m_id = dataset.id();
     checkHDF5Call(H5Iinc_ref(dataset.id()), "H5Iinc_ref");
     this->m_communicator = dataset.communicator();
+    this->m_transferMode = dataset.transferMode();
+    this->m_metadata = dataset.m_metadata;
     return *this;
 }
 
-hid_t PLI::HDF5::Dataset::createXfID() const {
+PLI::HDF5::Dataset::Metadata::Metadata() {
+    transferPlists.fill(H5I_INVALID_HID);
+}
+
+PLI::HDF5::Dataset::Metadata::~Metadata() {
+    // Handles might already be closed when the HDF5 library shuts down.
+    if (H5Iis_valid(typeID) > 0) {
+        H5Tclose(typeID);
+    }
+    for (const hid_t plist : transferPlists) {
+        if (H5Iis_valid(plist) > 0) {
+            H5Pclose(plist);
+        }
+    }
+}
+
+PLI::HDF5::Dataset::Metadata &PLI::HDF5::Dataset::metadata() const {
+    checkHDF5Ptr(this->m_id, "PLI::HDF5::Dataset::metadata");
+    if (!m_metadata) {
+        m_metadata = std::make_shared<Metadata>();
+    }
+    std::lock_guard<std::mutex> lock(m_metadata->mutex);
+    if (m_metadata->loaded) {
+        return *m_metadata;
+    }
+
+    hid_t dataspace = H5Dget_space(this->m_id);
+    checkHDF5Ptr(dataspace, "H5Dget_space");
+    const int numDims = H5Sget_simple_extent_ndims(dataspace);
+    std::vector<hsize_t> _dims(std::max(numDims, 0));
+    std::vector<hsize_t> _maxDims(std::max(numDims, 0));
+    herr_t status =
+        H5Sget_simple_extent_dims(dataspace, _dims.data(), _maxDims.data());
+    checkHDF5Call(H5Sclose(dataspace), "H5Sclose");
+    checkHDF5Call(numDims, "H5Sget_simple_extent_ndims");
+    checkHDF5Call(status, "H5Sget_simple_extent_dims");
+    m_metadata->dims = std::vector<size_t>(_dims.begin(), _dims.end());
+    m_metadata->maxDims.resize(_maxDims.size());
+    std::transform(_maxDims.begin(), _maxDims.end(),
+                   m_metadata->maxDims.begin(), [](const hsize_t dim) {
+                       return dim == H5S_UNLIMITED ? UNLIMITED
+                                                   : static_cast<size_t>(dim);
+                   });
+
+    // Layout, chunk dimensions and datatype can't change after creation.
+    if (m_metadata->typeID == H5I_INVALID_HID) {
+        hid_t plist = H5Dget_create_plist(this->m_id);
+        checkHDF5Ptr(plist, "H5Dget_create_plist");
+        m_metadata->chunked = H5Pget_layout(plist) == H5D_CHUNKED;
+        if (m_metadata->chunked && numDims > 0) {
+            std::vector<hsize_t> _chunkDims(numDims);
+            status = H5Pget_chunk(plist, numDims, _chunkDims.data());
+            m_metadata->chunkDims =
+                std::vector<size_t>(_chunkDims.begin(), _chunkDims.end());
+        }
+        checkHDF5Call(H5Pclose(plist), "H5Pclose");
+        checkHDF5Call(status, "H5Pget_chunk");
+
+        hid_t typePtr = H5Dget_type(this->m_id);
+        checkHDF5Ptr(typePtr, "H5Dget_type");
+        m_metadata->typeID = typePtr;
+    }
+    m_metadata->loaded = true;
+    return *m_metadata;
+}
+
+void PLI::HDF5::Dataset::resetMetadata() {
+    m_metadata = std::make_shared<Metadata>();
+}
+
+void PLI::HDF5::Dataset::invalidateMetadata() {
+    if (!m_metadata) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(m_metadata->mutex);
+    m_metadata->loaded = false;
+}
+
+hid_t PLI::HDF5::Dataset::transferPlist(
+    const std::optional<TransferMode> transferMode) const {
+    if (!m_communicator) {
+        return H5P_DEFAULT;
+    }
+    Metadata &metadata = this->metadata();
+    const TransferMode mode = transferMode.value_or(m_transferMode);
+    const size_t index = static_cast<size_t>(mode);
+    std::lock_guard<std::mutex> lock(metadata.mutex);
+    if (metadata.transferPlists[index] != H5I_INVALID_HID) {
+        return metadata.transferPlists[index];
+    }
+
     hid_t xf_id = H5Pcreate(H5P_DATASET_XFER);
     checkHDF5Ptr(xf_id, "H5Pcreate");
-
-    if (m_communicator) {
+    switch (mode) {
+    case TransferMode::Independent:
         checkHDF5Call(H5Pset_dxpl_mpio(xf_id, H5FD_MPIO_INDEPENDENT),
                       "H5Pset_dxpl_mpio");
+        break;
+    case TransferMode::Collective:
+        checkHDF5Call(H5Pset_dxpl_mpio(xf_id, H5FD_MPIO_COLLECTIVE),
+                      "H5Pset_dxpl_mpio");
+        break;
+    case TransferMode::CollectiveLinkedChunks:
+        checkHDF5Call(H5Pset_dxpl_mpio(xf_id, H5FD_MPIO_COLLECTIVE),
+                      "H5Pset_dxpl_mpio");
+        checkHDF5Call(H5Pset_dxpl_mpio_chunk_opt(xf_id, H5FD_MPIO_CHUNK_ONE_IO),
+                      "H5Pset_dxpl_mpio_chunk_opt");
+        break;
+    case TransferMode::CollectiveMultiChunk:
+        checkHDF5Call(H5Pset_dxpl_mpio(xf_id, H5FD_MPIO_COLLECTIVE),
+                      "H5Pset_dxpl_mpio");
+        checkHDF5Call(
+            H5Pset_dxpl_mpio_chunk_opt(xf_id, H5FD_MPIO_CHUNK_MULTI_IO),
+            "H5Pset_dxpl_mpio_chunk_opt");
+        break;
     }
+    metadata.transferPlists[index] = xf_id;
     return xf_id;
 }
 
+void PLI::HDF5::Dataset::selectHyperslab(
+    hid_t dataspacePtr, hid_t memspacePtr,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab) {
+    const Hyperslab::Extent &count = hyperslab.count();
+    // Processes without any elements still have to take part in collective
+    // calls. HDF5 expects an empty selection on both dataspaces in this case.
+    if (std::find(count.begin(), count.end(), 0) != count.end()) {
+        checkHDF5Call(H5Sselect_none(dataspacePtr), "H5Sselect_none");
+        checkHDF5Call(H5Sselect_none(memspacePtr), "H5Sselect_none");
+        return;
+    }
+    checkHDF5Call(H5Sselect_hyperslab(dataspacePtr, H5S_SELECT_SET,
+                                      hyperslab.offset().data(),
+                                      hyperslab.stride().data(), count.data(),
+                                      nullptr),
+                  "H5Sselect_hyperslab");
+}
+
+PLI::HDF5::ChunkGrid PLI::HDF5::Dataset::chunkGrid() const {
+    return this->chunkGrid(this->chunkDims());
+}
+
+PLI::HDF5::ChunkGrid
+PLI::HDF5::Dataset::chunkGrid(const std::vector<size_t> &chunkDims) const {
+    return PLI::HDF5::ChunkGrid(this->dims(), chunkDims);
+}
+
 std::vector<PLI::HDF5::Dataset::Hyperslab>
 PLI::HDF5::Dataset::getChunks() const {
-    return this->getChunks(this->chunkDims());
+    return this->chunkGrid().toVector();
 }
 
 std::vector<PLI::HDF5::Dataset::Hyperslab>
 PLI::HDF5::Dataset::getChunks(const std::vector<size_t> &chunkDims) const {
-    auto hyperslab = PLI::HDF5::Dataset::Hyperslab(
-        chunkDims, std::vector<size_t>(chunkDims.size(), 0));
-    return PLI::HDF5::Dataset::chunkTensor(this->dims(), hyperslab);
+    return this->chunkGrid(chunkDims).toVector();
 }
 
 /*
@@ -361,26 +1810,20 @@ PLI::HDF5::Dataset::Hyperslab PLI::HDF5::Dataset::Slices::toHyperslab() const {
  */
 
 PLI::HDF5::Dataset::Hyperslab::Hyperslab(
-    const PLI::HDF5::Dataset::Slice &slice) {
-    this->m_offset = std::vector<size_t>(slice.start);
-    this->m_count = std::vector<size_t>(slice.start + slice.stop * slice.step);
-    this->m_stride = std::vector<size_t>(slice.step);
-}
+    const PLI::HDF5::Dataset::Slice &slice)
+    : Hyperslab(slice.toHyperslab()) {}
 
 PLI::HDF5::Dataset::Hyperslab::Hyperslab(size_t offset, size_t count,
-                                         size_t stride) {
-    this->m_offset = std::vector<size_t>(offset);
-    this->m_count = std::vector<size_t>(count);
-    this->m_stride = std::vector<size_t>(stride);
-}
+                                         size_t stride)
+    : m_offset{offset}, m_count{count}, m_stride{stride} {}
 
-PLI::HDF5::Dataset::Hyperslab::Hyperslab(const std::vector<size_t> &offset,
-                                         const std::vector<size_t> &count,
-                                         const std::vector<size_t> &stride)
+PLI::HDF5::Dataset::Hyperslab::Hyperslab(const Extent &offset,
+                                         const Extent &count,
+                                         const Extent &stride)
     : m_offset(offset), m_count(count), m_stride(stride) {
 
     if (this->m_stride.empty())
-        this->m_stride = std::vector<size_t>(this->m_offset.size(), 1);
+        this->m_stride.assign(this->m_offset.size(), 1);
 
     if (this->m_offset.size() != this->m_count.size() ||
         this->m_offset.size() != this->m_stride.size())
@@ -440,35 +1883,11 @@ PLI::HDF5::Dataset::Slices PLI::HDF5::Dataset::Hyperslab::toSlices() const {
 std::vector<PLI::HDF5::Dataset::Hyperslab> PLI::HDF5::Dataset::chunkTensor(
     const std::vector<size_t> &tensorDims,
     const PLI::HDF5::Dataset::Hyperslab &chunk_hyperslab) {
-    std::vector<PLI::HDF5::Dataset::Hyperslab> chunks;
-
     if (tensorDims.size() != chunk_hyperslab.size())
         throw PLI::HDF5::Exceptions::DimensionMismatchException(
             "Dimension size does not match");
 
-    auto offset = chunk_hyperslab.offset();
-
-    // increment offset, beginning with last element, and save valid slices
-    while (offset[0] < tensorDims[0]) {
-        // set current offset chunk dimension
-        auto dim = chunk_hyperslab.count();
-        for (std::size_t i = 0; i < tensorDims.size(); i++) {
-            if (dim[i] + offset[i] > tensorDims[i])
-                dim[i] = tensorDims[i] - offset[i];
-        }
-
-        chunks.push_back(PLI::HDF5::Dataset::Hyperslab(offset, dim));
-
-        // increment offset, beginning with last
-        for (auto i = static_cast<int64_t>(tensorDims.size()) - 1; i >= 0;
-             i--) {
-            offset[i] += chunk_hyperslab.count()[i];
-            if (offset[i] >= tensorDims[i] && i > 0) {
-                offset[i] = chunk_hyperslab.offset()[i];
-            } else {
-                break;
-            }
-        }
-    }
-    return chunks;
+    return PLI::HDF5::ChunkGrid(tensorDims, chunk_hyperslab.count(),
+                                chunk_hyperslab.offset())
+        .toVector();
 }
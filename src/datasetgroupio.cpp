@@ -0,0 +1,179 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/datasetgroupio.h"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+
+#include "PLIHDF5/exceptions.h"
+
+PLI::HDF5::DatasetGroupIO::DatasetGroupIO(
+    const std::vector<Dataset> &datasets) {
+    for (const Dataset &dataset : datasets) {
+        this->add(dataset);
+    }
+}
+
+void PLI::HDF5::DatasetGroupIO::add(const Dataset &dataset) {
+    checkHDF5Ptr(dataset.id(), "PLI::HDF5::DatasetGroupIO::add");
+    m_datasets.push_back(dataset);
+}
+
+size_t PLI::HDF5::DatasetGroupIO::size() const noexcept {
+    return m_datasets.size();
+}
+
+const std::vector<PLI::HDF5::Dataset> &
+PLI::HDF5::DatasetGroupIO::datasets() const noexcept {
+    return m_datasets;
+}
+
+void PLI::HDF5::DatasetGroupIO::read(
+    std::span<void *const> outputs,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    this->transfer(true, outputs, hyperslab, type, transferMode);
+}
+
+void PLI::HDF5::DatasetGroupIO::write(
+    std::span<const void *const> data,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) {
+    // The buffers are only read from when writing.
+    std::vector<void *> buffers(data.size());
+    std::transform(
+        data.begin(), data.end(), buffers.begin(),
+        [](const void *buffer) { return const_cast<void *>(buffer); });
+    this->transfer(false, buffers, hyperslab, type, transferMode);
+}
+
+void PLI::HDF5::DatasetGroupIO::transfer(
+    const bool isRead, std::span<void *const> buffers,
+    const PLI::HDF5::Dataset::Hyperslab &hyperslab,
+    const PLI::HDF5::Type &type,
+    const std::optional<TransferMode> transferMode) const {
+    if (buffers.size() != m_datasets.size()) {
+        throw Exceptions::DimensionMismatchException(
+            "Number of buffers does not match the number of datasets.");
+    }
+    if (m_datasets.empty()) {
+        return;
+    }
+    const Dataset::Hyperslab::Extent &count = hyperslab.count();
+
+    const Dataset &first = m_datasets.front();
+    const size_t numElements = std::accumulate(
+        count.begin(), count.end(), size_t{1}, std::multiplies<std::size_t>());
+    if (first.communicator().has_value() &&
+        numElements > static_cast<size_t>(std::numeric_limits<int>::max())) {
+        throw PLI::HDF5::Exceptions::DatasetOperationOverflowException(
+            "The requested amount of elements is not allowed when using "
+            "MPI! Consider using chunk iterators or access the datasets in "
+            "selected amounts.");
+    }
+
+    // Check all datasets before any HDF5 handle is opened.
+    const Dataset::Hyperslab::Extent &offset = hyperslab.offset();
+    const Dataset::Hyperslab::Extent &stride = hyperslab.stride();
+    for (const Dataset &dataset : m_datasets) {
+        const std::vector<size_t> dims = dataset.dims();
+        if (offset.size() != dims.size() || count.size() != dims.size() ||
+            stride.size() != dims.size()) {
+            throw Exceptions::DimensionMismatchException(
+                "Hyperslab dimensions must have the same size as dataset "
+                "dimensions.");
+        }
+        for (size_t i = 0; i < dims.size(); ++i) {
+            if (count[i] > 0 &&
+                offset[i] + (count[i] - 1) * stride[i] >= dims[i]) {
+                throw Exceptions::DimensionMismatchException(
+                    "Hyperslab exceeds the dataset dimensions.");
+            }
+        }
+    }
+    const hid_t xf_id = first.transferPlist(transferMode);
+
+    // Closes the dataspaces when leaving this method, also if opening a
+    // dataspace or selecting the hyperslab throws.
+    struct Dataspaces {
+        hid_t memspace = H5I_INVALID_HID;
+        std::vector<hid_t> filespaces;
+        ~Dataspaces() {
+            for (const hid_t filespace : filespaces) {
+                H5Sclose(filespace);
+            }
+            if (memspace >= 0) {
+                H5Sclose(memspace);
+            }
+        }
+    } spaces;
+
+    spaces.memspace = H5Screate_simple(count.size(), count.data(), nullptr);
+    checkHDF5Ptr(spaces.memspace, "H5Screate_simple");
+    const size_t numDatasets = m_datasets.size();
+    std::vector<hid_t> datasetIDs(numDatasets);
+    spaces.filespaces.reserve(numDatasets);
+    for (size_t i = 0; i < numDatasets; ++i) {
+        datasetIDs[i] = m_datasets[i].id();
+        const hid_t filespacePtr = H5Dget_space(datasetIDs[i]);
+        checkHDF5Ptr(filespacePtr, "H5Dget_space");
+        spaces.filespaces.push_back(filespacePtr);
+        Dataset::selectHyperslab(filespacePtr, spaces.memspace, hyperslab);
+    }
+
+    herr_t status = 0;
+#if H5_VERSION_GE(1, 14, 0)
+    // One call for all datasets, so collective MPI-IO synchronizes once.
+    std::vector<hid_t> memTypes(numDatasets, type);
+    std::vector<hid_t> memspaces(numDatasets, spaces.memspace);
+    if (isRead) {
+        std::vector<void *> data(buffers.begin(), buffers.end());
+        status = H5Dread_multi(numDatasets, datasetIDs.data(), memTypes.data(),
+                               memspaces.data(), spaces.filespaces.data(),
+                               xf_id, data.data());
+    } else {
+        std::vector<const void *> data(buffers.begin(), buffers.end());
+        status = H5Dwrite_multi(numDatasets, datasetIDs.data(), memTypes.data(),
+                                memspaces.data(), spaces.filespaces.data(),
+                                xf_id, data.data());
+    }
+#else
+    // Multi-dataset I/O is not available. Access the datasets one after
+    // another with the shared memory dataspace and transfer plist. The
+    // accesses are not overlapped, as HDF5 serializes all calls anyway.
+    for (size_t i = 0; i < numDatasets && status >= 0; ++i) {
+        status = isRead ? H5Dread(datasetIDs[i], type, spaces.memspace,
+                                  spaces.filespaces[i], xf_id, buffers[i])
+                        : H5Dwrite(datasetIDs[i], type, spaces.memspace,
+                                   spaces.filespaces[i], xf_id, buffers[i]);
+    }
+#endif
+
+    checkHDF5Call(status, isRead ? "H5Dread" : "H5Dwrite");
+}
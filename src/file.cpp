@@ -25,24 +25,35 @@
 
 #include "PLIHDF5/file.h"
 
+#include <algorithm>
+#include <atomic>
 #include <iostream>
 
+#include "PLIHDF5/asyncio.h"
+#include "PLIHDF5/config.h"
 #include "PLIHDF5/exceptions.h"
 
 PLI::HDF5::File
 PLI::HDF5::createFile(const std::string &fileName,
                       const PLI::HDF5::File::CreateState creationState,
-                      const std::optional<MPI_Comm> communicator) {
+                      const std::optional<MPI_Comm> communicator,
+                      const std::optional<FileAccessOptions> &accessOptions,
+                      const FileCreateOptions &createOptions) {
     PLI::HDF5::File file;
-    file.create(fileName, creationState, communicator);
+    file.create(fileName, creationState, communicator, accessOptions,
+                createOptions);
     return file;
 }
 
 void PLI::HDF5::File::create(const std::string &fileName,
                              const CreateState creationState,
-                             const std::optional<MPI_Comm> communicator) {
+                             const std::optional<MPI_Comm> communicator,
+                             const std::optional<FileAccessOptions>
+                                 &accessOptions,
+                             const FileCreateOptions &createOptions) {
     this->m_communicator = communicator;
-    hid_t fapl_id = createFaplID();
+    hid_t fapl_id =
+        createFaplID(accessOptions, createOptions.pagedAggregation);
     hid_t access;
     if (creationState == CreateState::OverrideExisting) {
         access = H5F_ACC_TRUNC;
@@ -53,7 +64,14 @@ void PLI::HDF5::File::create(const std::string &fileName,
         }
         access = H5F_ACC_EXCL;
     }
-    hid_t filePtr = H5Fcreate(fileName.c_str(), access, H5P_DEFAULT, fapl_id);
+    if (createOptions.swmr) {
+        checkHDF5Call(H5Pset_libver_bounds(fapl_id, H5F_LIBVER_LATEST,
+                                           H5F_LIBVER_LATEST),
+                      "H5Pset_libver_bounds");
+    }
+    hid_t fcpl_id = createFcplID(createOptions);
+    hid_t filePtr = H5Fcreate(fileName.c_str(), access, fcpl_id, fapl_id);
+    H5Pclose(fcpl_id);
     checkHDF5Ptr(filePtr, "H5Fcreate");
 
     this->m_id = filePtr;
@@ -63,15 +81,18 @@ void PLI::HDF5::File::create(const std::string &fileName,
 PLI::HDF5::File
 PLI::HDF5::openFile(const std::string &fileName,
                     const File::OpenState openState,
-                    const std::optional<MPI_Comm> communicator) {
+                    const std::optional<MPI_Comm> communicator,
+                    const std::optional<FileAccessOptions> &accessOptions) {
     PLI::HDF5::File file;
-    file.open(fileName, openState, communicator);
+    file.open(fileName, openState, communicator, accessOptions);
     return file;
 }
 
 void PLI::HDF5::File::open(const std::string &fileName,
                            const File::OpenState openState,
-                           const std::optional<MPI_Comm> communicator) {
+                           const std::optional<MPI_Comm> communicator,
+                           const std::optional<FileAccessOptions>
+                               &accessOptions) {
     if (!PLI::HDF5::File::fileExists(fileName)) {
         throw Exceptions::FileNotFoundException("File not found: " + fileName);
     }
@@ -84,18 +105,135 @@ void PLI::HDF5::File::open(const std::string &fileName,
     hid_t access;
     if (openState == OpenState::ReadOnly) {
         access = H5F_ACC_RDONLY;
+    } else if (openState == OpenState::SWMRRead) {
+        access = H5F_ACC_RDONLY | H5F_ACC_SWMR_READ;
     } else {
         access = H5F_ACC_RDWR;
     }
 
-    hid_t fapl_id = createFaplID();
-    hid_t filePtr = H5Fopen(fileName.c_str(), access, fapl_id);
+    hid_t fapl_id = createFaplID(accessOptions, true);
+    size_t pageBufferSize = 0;
+    unsigned minMetadataPercent, minRawDataPercent;
+    checkHDF5Call(H5Pget_page_buffer_size(fapl_id, &pageBufferSize,
+                                          &minMetadataPercent,
+                                          &minRawDataPercent),
+                  "H5Pget_page_buffer_size");
+    hid_t filePtr;
+    if (pageBufferSize > 0) {
+        // HDF5 refuses to open files without paged aggregation (or with
+        // pages larger than the buffer) if a page buffer is set. Such files
+        // are opened without page buffer instead.
+        H5E_BEGIN_TRY { filePtr = H5Fopen(fileName.c_str(), access, fapl_id); }
+        H5E_END_TRY;
+        if (filePtr < 0) {
+            checkHDF5Call(H5Pset_page_buffer_size(fapl_id, 0, 0, 0),
+                          "H5Pset_page_buffer_size");
+            filePtr = H5Fopen(fileName.c_str(), access, fapl_id);
+        }
+    } else {
+        filePtr = H5Fopen(fileName.c_str(), access, fapl_id);
+    }
+    checkHDF5Ptr(filePtr, "H5Fopen");
+
+    this->m_id = filePtr;
+    this->m_faplID = fapl_id;
+}
+
+PLI::HDF5::File
+PLI::HDF5::createInMemoryFile(const std::string &fileName,
+                              const size_t incrementBytes,
+                              const bool backingStore) {
+    PLI::HDF5::File file;
+    file.createInMemory(fileName, incrementBytes, backingStore);
+    return file;
+}
+
+void PLI::HDF5::File::createInMemory(const std::string &fileName,
+                                     const size_t incrementBytes,
+                                     const bool backingStore) {
+    this->m_communicator.reset();
+    hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    checkHDF5Ptr(fapl_id, "H5Pcreate");
+    checkHDF5Call(H5Pset_fapl_core(fapl_id, incrementBytes, backingStore),
+                  "H5Pset_fapl_core");
+    hid_t filePtr =
+        H5Fcreate(fileName.c_str(), H5F_ACC_TRUNC, H5P_DEFAULT, fapl_id);
+    checkHDF5Ptr(filePtr, "H5Fcreate");
+
+    this->m_id = filePtr;
+    this->m_faplID = fapl_id;
+}
+
+PLI::HDF5::File
+PLI::HDF5::openFileImage(std::span<const std::byte> image,
+                         const File::OpenState openState) {
+    PLI::HDF5::File file;
+    file.openImage(image, openState);
+    return file;
+}
+
+void PLI::HDF5::File::openImage(std::span<const std::byte> image,
+                                const OpenState openState) {
+    // The core driver identifies open files by their name. Each image gets
+    // its own name, so the same image can be opened more than once.
+    static std::atomic<size_t> imageCounter = 0;
+    const std::string imageName =
+        "plihdf5_file_image_" + std::to_string(imageCounter++);
+
+    this->m_communicator.reset();
+    hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
+    checkHDF5Ptr(fapl_id, "H5Pcreate");
+    checkHDF5Call(H5Pset_fapl_core(fapl_id, std::max<size_t>(image.size(), 1),
+                                   false),
+                  "H5Pset_fapl_core");
+    // H5Pset_file_image copies the buffer.
+    void *imageData = const_cast<std::byte *>(image.data());
+    checkHDF5Call(H5Pset_file_image(fapl_id, imageData, image.size()),
+                  "H5Pset_file_image");
+
+    // Only one process can access an image, so SWMR is not needed here.
+    hid_t access;
+    if (openState == OpenState::ReadWrite) {
+        access = H5F_ACC_RDWR;
+    } else {
+        access = H5F_ACC_RDONLY;
+    }
+    hid_t filePtr = H5Fopen(imageName.c_str(), access, fapl_id);
     checkHDF5Ptr(filePtr, "H5Fopen");
 
     this->m_id = filePtr;
     this->m_faplID = fapl_id;
 }
 
+std::vector<std::byte> PLI::HDF5::File::toImage() const {
+    checkHDF5Ptr(this->m_id, "H5Fget_file_image");
+    checkHDF5Call(H5Fflush(this->m_id, H5F_SCOPE_LOCAL), "H5Fflush");
+    // The image size does not fit into herr_t for large files.
+    ssize_t imageSize = H5Fget_file_image(this->m_id, nullptr, 0);
+    checkHDF5Call(imageSize < 0 ? -1 : 0, "H5Fget_file_image");
+
+    std::vector<std::byte> image(imageSize);
+    imageSize = H5Fget_file_image(this->m_id, image.data(), image.size());
+    checkHDF5Call(imageSize < 0 ? -1 : 0, "H5Fget_file_image");
+    return image;
+}
+
+void PLI::HDF5::File::startSWMRWrite() {
+    checkHDF5Ptr(this->m_id, "H5Fstart_swmr_write");
+    if (m_communicator) {
+        throw Exceptions::HDF5RuntimeException(
+            "SWMR mode is not available for files opened with MPI access.");
+    }
+    checkHDF5Call(H5Fstart_swmr_write(this->m_id), "H5Fstart_swmr_write");
+}
+
+bool PLI::HDF5::File::usesSWMR() const {
+    checkHDF5Ptr(this->m_id, "H5Fget_intent");
+    unsigned intent;
+    checkHDF5Call(H5Fget_intent(this->m_id, &intent), "H5Fget_intent");
+    return intent & (H5F_ACC_SWMR_WRITE | H5F_ACC_SWMR_READ);
+}
+
 void PLI::HDF5::File::reopen() {
     checkHDF5Ptr(this->m_id, "H5Fopen");
     this->m_id = H5Freopen(this->m_id);
@@ -115,13 +253,19 @@ bool PLI::HDF5::File::fileExists(const std::string &fileName) {
     return std::filesystem::exists(fileName);
 }
 
+void PLI::HDF5::File::waitAll() const {
+    IOQueue::getInstance()->waitAll(this->m_id);
+}
+
 hid_t PLI::HDF5::File::faplID() const { return this->m_faplID; }
 
 PLI::HDF5::File::File(const std::optional<MPI_Comm> communicator)
     : Folder(communicator), m_faplID(-1) {}
 
 PLI::HDF5::File::File(const File &other)
-    : Folder(other.id(), other.communicator()), m_faplID(other.faplID()) {}
+    : Folder(other.id(), other.communicator()), m_faplID(other.faplID()) {
+    this->m_transferMode = other.transferMode();
+}
 
 PLI::HDF5::File::File(const hid_t filePtr, const hid_t faplID)
     : Folder(filePtr), m_faplID(faplID) {
@@ -145,19 +289,86 @@ PLI::HDF5::File &PLI::HDF5::File::operator=(const File &other) noexcept {
     this->m_faplID = other.faplID();
     checkHDF5Call(H5Iinc_ref(this->m_faplID), "H5Iinc_ref");
     this->m_communicator = other.communicator();
+    this->m_transferMode = other.transferMode();
     return *this;
 }
 
-hid_t PLI::HDF5::File::createFaplID() const {
+hid_t PLI::HDF5::File::createFaplID(
+    const std::optional<FileAccessOptions> &accessOptions,
+    const bool pageBuffer) const {
+    const FileAccessOptions options =
+        accessOptions ? accessOptions.value()
+                      : Config::getInstance()->getFileAccessOptions();
+
     hid_t fapl_id = H5Pcreate(H5P_FILE_ACCESS);
     checkHDF5Ptr(fapl_id, "H5Pcreate");
     if (m_communicator) {
+        MPI_Info info = MPI_INFO_NULL;
+        if (!options.mpiHints.empty()) {
+            MPI_Info_create(&info);
+            for (const auto &[key, value] : options.mpiHints) {
+                MPI_Info_set(info, key.c_str(), value.c_str());
+            }
+        }
+        // HDF5 duplicates the info object, so it can be freed right away.
+        herr_t returnCode =
+            H5Pset_fapl_mpio(fapl_id, m_communicator.value(), info);
+        if (info != MPI_INFO_NULL) {
+            MPI_Info_free(&info);
+        }
+        checkHDF5Call(returnCode, "H5Pset_fapl_mpio");
+
+        if (options.collectiveMetadataReads) {
+            checkHDF5Call(H5Pset_all_coll_metadata_ops(
+                              fapl_id, options.collectiveMetadataReads.value()),
+                          "H5Pset_all_coll_metadata_ops");
+        }
+        if (options.collectiveMetadataWrites) {
+            const bool collectiveWrites =
+                options.collectiveMetadataWrites.value();
+            checkHDF5Call(H5Pset_coll_metadata_write(fapl_id, collectiveWrites),
+                          "H5Pset_coll_metadata_write");
+        }
+    }
+    if (options.alignment) {
+        checkHDF5Call(H5Pset_alignment(fapl_id,
+                                       options.alignmentThreshold.value_or(1),
+                                       options.alignment.value()),
+                      "H5Pset_alignment");
+    }
+    if (options.metadataBlockSize) {
+        checkHDF5Call(
+            H5Pset_meta_block_size(fapl_id, options.metadataBlockSize.value()),
+            "H5Pset_meta_block_size");
+    }
+    // The MPI-IO driver does not support page buffering.
+    if (pageBuffer && options.pageBufferSize && !m_communicator) {
         checkHDF5Call(
-            H5Pset_fapl_mpio(fapl_id, m_communicator.value(), MPI_INFO_NULL));
+            H5Pset_page_buffer_size(fapl_id, options.pageBufferSize.value(),
+                                    options.pageBufferMinMetadataPercent,
+                                    options.pageBufferMinRawDataPercent),
+            "H5Pset_page_buffer_size");
     }
     return fapl_id;
 }
 
+hid_t PLI::HDF5::File::createFcplID(const FileCreateOptions &createOptions) {
+    hid_t fcpl_id = H5Pcreate(H5P_FILE_CREATE);
+    checkHDF5Ptr(fcpl_id, "H5Pcreate");
+    if (createOptions.pagedAggregation) {
+        checkHDF5Call(H5Pset_file_space_strategy(
+                          fcpl_id, H5F_FSPACE_STRATEGY_PAGE,
+                          createOptions.persistFreeSpace, 1),
+                      "H5Pset_file_space_strategy");
+        if (createOptions.pageSize) {
+            checkHDF5Call(H5Pset_file_space_page_size(
+                              fcpl_id, createOptions.pageSize.value()),
+                          "H5Pset_file_space_page_size");
+        }
+    }
+    return fcpl_id;
+}
+
 bool PLI::HDF5::File::usesMPIFileAccess() const {
     return m_communicator.has_value();
 }
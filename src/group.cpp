@@ -39,6 +39,8 @@ void PLI::HDF5::Group::open(const Folder &parentPtr,
     hid_t groupPtr = H5Gopen(parentPtr, groupName.c_str(), H5P_DEFAULT);
     checkHDF5Ptr(groupPtr);
     this->m_id = groupPtr;
+    this->m_communicator = parentPtr.communicator();
+    this->m_transferMode = parentPtr.transferMode();
 }
 
 void PLI::HDF5::Group::create(const Folder &parentPtr,
@@ -52,6 +54,8 @@ void PLI::HDF5::Group::create(const Folder &parentPtr,
                                H5P_DEFAULT, H5P_DEFAULT);
     checkHDF5Ptr(groupPtr, "H5Gcreate");
     this->m_id = groupPtr;
+    this->m_communicator = parentPtr.communicator();
+    this->m_transferMode = parentPtr.transferMode();
 }
 
 bool PLI::HDF5::Group::exists(const Folder &parentPtr,
@@ -65,7 +69,9 @@ PLI::HDF5::Group::Group(const hid_t groupPtr,
     : PLI::HDF5::Folder(groupPtr, communicator) {}
 
 PLI::HDF5::Group::Group(const Group &group) noexcept
-    : PLI::HDF5::Folder(group.id(), group.communicator()) {}
+    : PLI::HDF5::Folder(group.id(), group.communicator()) {
+    this->m_transferMode = group.transferMode();
+}
 
 PLI::HDF5::Group::Group() noexcept : PLI::HDF5::Folder() {}
 
@@ -76,6 +82,7 @@ PLI::HDF5::Group::operator=(const PLI::HDF5::Group &otherGroup) noexcept {
     this->m_id = otherGroup.id();
     checkHDF5Call(H5Iinc_ref(m_id), "H5Iinc_ref");
     this->m_communicator = otherGroup.communicator();
+    this->m_transferMode = otherGroup.transferMode();
     return *this;
 }
 
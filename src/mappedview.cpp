@@ -0,0 +1,143 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/mappedview.h"
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#define PLI_HDF5_HAS_MMAP
+#endif
+
+#include <utility>
+
+PLI::HDF5::MappedRegion::MappedRegion(MappedRegion &&other) noexcept
+    : m_mapping(std::exchange(other.m_mapping, nullptr)),
+      m_mappingLength(std::exchange(other.m_mappingLength, 0)),
+      m_regionOffset(std::exchange(other.m_regionOffset, 0)) {}
+
+PLI::HDF5::MappedRegion &
+PLI::HDF5::MappedRegion::operator=(MappedRegion &&other) noexcept {
+    if (this != &other) {
+        unmap();
+        m_mapping = std::exchange(other.m_mapping, nullptr);
+        m_mappingLength = std::exchange(other.m_mappingLength, 0);
+        m_regionOffset = std::exchange(other.m_regionOffset, 0);
+    }
+    return *this;
+}
+
+PLI::HDF5::MappedRegion::~MappedRegion() { unmap(); }
+
+bool PLI::HDF5::MappedRegion::map(const std::string &fileName,
+                                  const size_t offset, const size_t length,
+                                  const MapAdvice advice) noexcept {
+    unmap();
+#ifdef PLI_HDF5_HAS_MMAP
+    if (length == 0) {
+        return false;
+    }
+    int fileDescriptor = ::open(fileName.c_str(), O_RDONLY);
+    if (fileDescriptor < 0) {
+        return false;
+    }
+    // mmap requires an offset aligned to the page size.
+    const size_t pageSize = static_cast<size_t>(sysconf(_SC_PAGESIZE));
+    const size_t mappingOffset = offset - offset % pageSize;
+    const size_t mappingLength = length + (offset - mappingOffset);
+    void *mapping = mmap(nullptr, mappingLength, PROT_READ, MAP_SHARED,
+                         fileDescriptor, static_cast<off_t>(mappingOffset));
+    // The mapping stays valid after closing the file.
+    ::close(fileDescriptor);
+    if (mapping == MAP_FAILED) {
+        return false;
+    }
+    m_mapping = mapping;
+    m_mappingLength = mappingLength;
+    m_regionOffset = offset - mappingOffset;
+    advise(advice);
+    return true;
+#else
+    (void)fileName;
+    (void)offset;
+    (void)length;
+    (void)advice;
+    return false;
+#endif
+}
+
+void PLI::HDF5::MappedRegion::unmap() noexcept {
+#ifdef PLI_HDF5_HAS_MMAP
+    if (m_mapping != nullptr) {
+        munmap(m_mapping, m_mappingLength);
+    }
+#endif
+    m_mapping = nullptr;
+    m_mappingLength = 0;
+    m_regionOffset = 0;
+}
+
+void PLI::HDF5::MappedRegion::advise(const MapAdvice advice) const noexcept {
+#ifdef PLI_HDF5_HAS_MMAP
+    if (m_mapping == nullptr) {
+        return;
+    }
+    int flag = MADV_NORMAL;
+    switch (advice) {
+    case MapAdvice::Normal:
+        flag = MADV_NORMAL;
+        break;
+    case MapAdvice::Random:
+        flag = MADV_RANDOM;
+        break;
+    case MapAdvice::Sequential:
+        flag = MADV_SEQUENTIAL;
+        break;
+    case MapAdvice::WillNeed:
+        flag = MADV_WILLNEED;
+        break;
+    }
+    // Hints only, failures can be ignored.
+    madvise(m_mapping, m_mappingLength, flag);
+#else
+    (void)advice;
+#endif
+}
+
+bool PLI::HDF5::MappedRegion::isMapped() const noexcept {
+    return m_mapping != nullptr;
+}
+
+const void *PLI::HDF5::MappedRegion::data() const noexcept {
+    if (m_mapping == nullptr) {
+        return nullptr;
+    }
+    return static_cast<const char *>(m_mapping) + m_regionOffset;
+}
+
+size_t PLI::HDF5::MappedRegion::size() const noexcept {
+    return m_mapping == nullptr ? 0 : m_mappingLength - m_regionOffset;
+}
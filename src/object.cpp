@@ -25,17 +25,20 @@
 
 #include "PLIHDF5/object.h"
 
+#include "PLIHDF5/asyncio.h"
 #include "PLIHDF5/exceptions.h"
 
 PLI::HDF5::Object::Object(hid_t id,
                           const std::optional<MPI_Comm> &communicator) noexcept
-    : m_communicator(communicator), m_id(id) {
+    : m_communicator(communicator),
+      m_transferMode(TransferMode::Independent), m_id(id) {
     checkHDF5Ptr(id, "PLI::HDF5::Object::Object");
     checkHDF5Call(H5Iinc_ref(id), "H5Iinc_ref");
 }
 
 PLI::HDF5::Object::Object(const std::optional<MPI_Comm> &communicator) noexcept
-    : m_communicator(communicator), m_id(-1) {}
+    : m_communicator(communicator),
+      m_transferMode(TransferMode::Independent), m_id(-1) {}
 
 PLI::HDF5::Object::~Object() { close(); }
 
@@ -45,9 +48,21 @@ std::optional<MPI_Comm> PLI::HDF5::Object::communicator() const noexcept {
     return m_communicator;
 }
 
+PLI::HDF5::TransferMode PLI::HDF5::Object::transferMode() const noexcept {
+    return m_transferMode;
+}
+
+void PLI::HDF5::Object::setTransferMode(
+    const TransferMode transferMode) noexcept {
+    m_transferMode = transferMode;
+}
+
 PLI::HDF5::Object::operator hid_t() const noexcept { return m_id; }
 
 void PLI::HDF5::Object::close() {
+    // Asynchronous writes keep their datasets open. Closing the file would
+    // close them as well, so the writes of a file have to finish first.
+    IOQueue::getInstance()->waitAll(m_id);
     closeFileObjects(H5F_OBJ_LOCAL | ~H5F_OBJ_FILE);
     closeFileObjects(H5F_OBJ_LOCAL | H5F_OBJ_FILE);
 
@@ -0,0 +1,128 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include "PLIHDF5/pyramid.h"
+
+#include <algorithm>
+#include <iomanip>
+#include <sstream>
+#include <thread>
+
+#include "PLIHDF5/exceptions.h"
+
+PLI::HDF5::Pyramid::Pyramid(const PyramidOptions &options) noexcept
+    : m_options(options) {}
+
+size_t PLI::HDF5::Pyramid::numLevels(const std::vector<size_t> &dims,
+                                     const size_t minSize) {
+    std::vector<size_t> plane(dims.begin(),
+                              dims.begin() + std::min<size_t>(2, dims.size()));
+    size_t levels = 0;
+    while (!plane.empty() &&
+           *std::max_element(plane.begin(), plane.end()) >
+               std::max<size_t>(1, minSize)) {
+        for (size_t &dim : plane) {
+            dim = (dim + 1) / 2;
+        }
+        ++levels;
+    }
+    return levels;
+}
+
+std::vector<size_t>
+PLI::HDF5::Pyramid::levelDims(const std::vector<size_t> &dims,
+                              const size_t level, const bool reduceDepth) {
+    std::vector<size_t> _levelDims = dims;
+    const size_t reducedDims =
+        std::min<size_t>(reduceDepth ? 3 : 2, _levelDims.size());
+    for (size_t i = 0; i < reducedDims; ++i) {
+        for (size_t l = 0; l < level; ++l) {
+            _levelDims[i] = (_levelDims[i] + 1) / 2;
+        }
+    }
+    return _levelDims;
+}
+
+std::string PLI::HDF5::Pyramid::levelName(const size_t level) {
+    std::ostringstream name;
+    name << std::setw(2) << std::setfill('0') << level;
+    return name.str();
+}
+
+PLI::HDF5::Dataset
+PLI::HDF5::Pyramid::createLevel(const Dataset &source, Group &group,
+                                const size_t level,
+                                const PLI::HDF5::Type &type) const {
+    const std::vector<size_t> dims =
+        levelDims(source.dims(), level, m_options.reduceDepth);
+    DatasetCreateOptions options = m_options.datasetOptions;
+    options.maxDims.clear();
+    if (!options.chunkDims.empty()) {
+        // Chunks of the higher levels must not exceed the level itself.
+        for (size_t i = 0; i < std::min(dims.size(), options.chunkDims.size());
+             ++i) {
+            options.chunkDims[i] = std::clamp<size_t>(
+                options.chunkDims[i], 1, std::max<size_t>(1, dims[i]));
+        }
+    } else if (!options.chunkPolicy.has_value()) {
+        options.chunkPolicy = ChunkPolicy{};
+    }
+    return group.createDataset(levelName(level), dims, options, type);
+}
+
+PLI::HDF5::Dataset PLI::HDF5::Pyramid::linkSource(const Dataset &source,
+                                                  Group &group) {
+    checkHDF5Ptr(source, "PLI::HDF5::Pyramid::linkSource");
+    checkHDF5Ptr(group, "PLI::HDF5::Pyramid::linkSource");
+    const std::string name = levelName(0);
+    herr_t status;
+    // Hard links cannot point to another file. In this case, the source is
+    // copied instead.
+    H5E_BEGIN_TRY {
+        status = H5Lcreate_hard(source, ".", group, name.c_str(), H5P_DEFAULT,
+                                H5P_DEFAULT);
+    }
+    H5E_END_TRY;
+    if (status >= 0) {
+        return group.openDataset(name);
+    }
+
+    // Keep chunking and filters of the source, so the stored chunks can be
+    // copied as they are.
+    const DatasetCreateOptions options = source.createOptions();
+    const PLI::HDF5::Type dataType = source.type();
+    Dataset level =
+        group.createDataset(name, source.dims(), options, dataType);
+    checkHDF5Call(H5Tclose(dataType), "H5Tclose");
+    source.copyChunksTo(level);
+    return level;
+}
+
+unsigned PLI::HDF5::Pyramid::numThreads() const noexcept {
+    if (m_options.numThreads > 0) {
+        return m_options.numThreads;
+    }
+    return std::max(1u, std::thread::hardware_concurrency());
+}
@@ -72,45 +72,24 @@ hid_t PLI::HDF5::Type::convertNameToID(const std::string &name) {
     return H5LTtext_to_dtype(name.c_str(), H5LT_DDL);
 }
 
-// Unsigned Int
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<uint8_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_UCHAR");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<uint16_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_USHORT");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<uint32_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_UINT");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<uint64_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_ULONG");
-}
-
-// Int
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<int8_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_SCHAR");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<int16_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_SHORT");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<int32_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_INT");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<int64_t>() {
-    return PLI::HDF5::Type("H5T_NATIVE_LONG");
-}
-
-// Float
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<float>() {
-    return PLI::HDF5::Type("H5T_NATIVE_FLOAT");
-}
-
-template <> PLI::HDF5::Type PLI::HDF5::Type::createType<double>() {
-    return PLI::HDF5::Type("H5T_NATIVE_DOUBLE");
+hid_t PLI::HDF5::createCompoundType(
+    const size_t size, std::initializer_list<CompoundMember> members) {
+    hid_t typeID = H5Tcreate(H5T_COMPOUND, size);
+    checkHDF5Ptr(typeID, "H5Tcreate");
+    for (const CompoundMember &member : members) {
+        herr_t status =
+            H5Tinsert(typeID, member.name, member.offset, member.typeID);
+        if (status < 0) {
+            H5Tclose(typeID);
+            checkHDF5Call(status, "H5Tinsert");
+        }
+    }
+    return typeID;
+}
+
+hid_t PLI::HDF5::createArrayType(const hid_t baseTypeID, const size_t size) {
+    const hsize_t dims[1] = {size};
+    hid_t typeID = H5Tarray_create2(baseTypeID, 1, dims);
+    checkHDF5Ptr(typeID, "H5Tarray_create2");
+    return typeID;
 }
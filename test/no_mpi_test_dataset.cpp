@@ -25,9 +25,15 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
+#include <complex>
 #include <filesystem>
+#include <future>
 #include <numeric>
 
+#include "PLIHDF5/bufferedwriter.h"
+#include "PLIHDF5/chunkscheduler.h"
 #include "PLIHDF5/dataset.h"
 #include "PLIHDF5/file.h"
 
@@ -166,6 +172,13 @@ TEST_F(PLI_HDF5_Dataset_Non_MPI, type) {
         EXPECT_NO_THROW(dset.type());
         dset.close();
     }
+    { // the type stays valid after the dataset is closed
+        _file.createDataset<float>("/Image_2", _dims, _chunk_dims).close();
+        const PLI::HDF5::Type type = _file.openDataset("/Image_2").type();
+        EXPECT_GT(H5Iis_valid(type), 0);
+        EXPECT_TRUE(type == PLI::HDF5::Type::createType<float>());
+        H5Tclose(type);
+    }
 }
 
 TEST_F(PLI_HDF5_Dataset_Non_MPI, ndims) {
@@ -295,16 +308,709 @@ TEST_F(PLI_HDF5_Dataset_Non_MPI, readLimit) {
 
     { // read dataset
         auto dset = _file.openDataset("/Image");
-        // We expect another exception than in the MPI version because our input
-        // dataset is too small. However, the exception is thrown after the
+        // We expect another exception than in the MPI version because offset
+        // and count do not match. However, the exception is thrown after the
         // initial check if we would run into issues with MPI.
         EXPECT_THROW(
             const auto data_in = dset.read<int>(
                 offset,
                 {static_cast<size_t>(std::numeric_limits<int>::max()) + 1}),
-            PLI::HDF5::Exceptions::HDF5RuntimeException);
+            PLI::HDF5::Exceptions::DimensionMismatchException);
+        dset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, writeLimit) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    auto dset = _file.createDataset<int>("/Image", _dims, _chunk_dims);
+    // Offset and count do not match
+    EXPECT_THROW(dset.write(data, {0, 0, 0}, {_dims[0], _dims[1]}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    EXPECT_THROW(dset.write(data.data(), {0, 0}, _dims, {},
+                            PLI::HDF5::Type::createType<int>()),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    // Offset and stride do not match
+    EXPECT_THROW(dset.write(data, {0, 0, 0}, _dims, {1, 1}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, chunks) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+    auto dset = _file.createDataset<int>("/Image", _dims, {32, 32, 4});
+    dset.write(data, offset, _dims);
+
+    auto range = dset.chunks<int>();
+    hbool_t threadSafe = false;
+    H5is_library_threadsafe(&threadSafe);
+    EXPECT_EQ(range.prefetching(), bool(threadSafe));
+    EXPECT_FALSE(dset.chunks<int>({}, false).prefetching());
+    size_t numChunks = 0;
+    for (const auto &chunk : range) {
+        EXPECT_TRUE(chunk.data == dset.read<int>(chunk.hyperslab));
+        ++numChunks;
+    }
+    EXPECT_TRUE(numChunks == 16);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, filters) {
+    std::vector<float> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                            std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0.0f);
+    const std::vector<size_t> offset{{0, 0, 0}};
+
+    { // built-in filters
+        PLI::HDF5::DatasetCreateOptions options;
+        options.chunkDims = {64, 64, 4};
+        options.shuffle = PLI::HDF5::Shuffle::Byte;
+        options.compression = PLI::HDF5::Compression::Deflate;
+        options.compressionLevel = 6;
+        options.fletcher32 = true;
+        auto dset = _file.createDataset<float>("/Deflate", _dims, options);
+        EXPECT_TRUE(dset.filters().size() == 3);
+        const auto createOptions = dset.createOptions();
+        EXPECT_EQ(createOptions.chunkDims, options.chunkDims);
+        EXPECT_TRUE(createOptions.maxDims.empty());
+        EXPECT_EQ(createOptions.shuffle, options.shuffle);
+        EXPECT_EQ(createOptions.compression, options.compression);
+        EXPECT_EQ(createOptions.compressionLevel, options.compressionLevel);
+        EXPECT_TRUE(createOptions.fletcher32);
+        dset.write(data, offset, _dims);
+        EXPECT_TRUE(dset.readFullDataset<float>() == data);
+        dset.close();
+    }
+
+    { // filters without chunking
+        PLI::HDF5::DatasetCreateOptions options;
+        options.compression = PLI::HDF5::Compression::Deflate;
+        EXPECT_THROW(_file.createDataset<float>("/NoChunks", _dims, options),
+                     PLI::HDF5::Exceptions::HDF5RuntimeException);
+    }
+
+    { // plugin filters
+        PLI::HDF5::DatasetCreateOptions options;
+        options.chunkDims = {64, 64, 4};
+        options.shuffle = PLI::HDF5::Shuffle::Bit;
+        options.compression = PLI::HDF5::Compression::Zstd;
+        if (PLI::HDF5::Dataset::filterAvailable(options.shuffle) &&
+            PLI::HDF5::Dataset::filterAvailable(options.compression)) {
+            auto dset = _file.createDataset<float>("/Zstd", _dims, options);
+            dset.write(data, offset, _dims);
+            EXPECT_TRUE(dset.readFullDataset<float>() == data);
+            dset.close();
+        } else {
+            EXPECT_THROW(_file.createDataset<float>("/Zstd", _dims, options),
+                         PLI::HDF5::Exceptions::FilterNotAvailableException);
+        }
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, rawChunks) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+
+    { // write and read uncompressed chunks
+        auto dset = _file.createDataset<int>("/Raw", _dims, {64, 128, 4});
+        EXPECT_TRUE(dset.readRawChunk({64, 0, 0}).data.empty());
+        std::vector<int> chunk(64 * 128 * 4);
+        std::iota(chunk.begin(), chunk.end(), 0);
+        const auto bytes = reinterpret_cast<const uint8_t *>(chunk.data());
+        dset.writeRawChunk({64, 0, 0},
+                           std::vector<uint8_t>(bytes, bytes + chunk.size() *
+                                                                   sizeof(int)));
+        EXPECT_TRUE(dset.read<int>(std::vector<size_t>{64, 0, 0},
+                                   std::vector<size_t>{64, 128, 4}) == chunk);
+        EXPECT_TRUE(dset.readRawChunk({64, 0, 0}).data.size() ==
+                    chunk.size() * sizeof(int));
+        EXPECT_THROW(dset.readRawChunk({64, 0}),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
         dset.close();
     }
+
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {32, 64, 4};
+    options.shuffle = PLI::HDF5::Shuffle::Byte;
+    options.compression = PLI::HDF5::Compression::Deflate;
+    auto source = _file.createDataset<int>("/Source", _dims, options);
+    source.write(data, offset, _dims);
+
+    { // matching chunks and filters are copied directly
+        auto target = _file.createDataset<int>("/Copy", _dims, options);
+        EXPECT_TRUE(source.copyChunksTo(target));
+        EXPECT_TRUE(target.readFullDataset<int>() == data);
+        EXPECT_TRUE(target.readRawChunk({32, 64, 0}).data ==
+                    source.readRawChunk({32, 64, 0}).data);
+        target.close();
+    }
+
+    { // chunks which were never written stay unallocated
+        auto sparse = _file.createDataset<int>("/Sparse", _dims, options);
+        const std::vector<int> chunk(32 * 64 * 4, 7);
+        sparse.write(chunk, std::vector<size_t>{32, 64, 0},
+                     std::vector<size_t>{32, 64, 4});
+        EXPECT_TRUE(sparse.readRawChunk({0, 0, 0}).data.empty());
+        EXPECT_FALSE(sparse.readRawChunk({32, 64, 0}).data.empty());
+        EXPECT_THROW(sparse.readRawChunk({1, 0, 0}),
+                     PLI::HDF5::Exceptions::HDF5RuntimeException);
+
+        auto target = _file.createDataset<int>("/SparseCopy", _dims, options);
+        EXPECT_TRUE(sparse.copyChunksTo(target));
+        EXPECT_TRUE(target.readFullDataset<int>() ==
+                    sparse.readFullDataset<int>());
+        EXPECT_TRUE(target.readRawChunk({0, 0, 0}).data.empty());
+        sparse.close();
+        target.close();
+    }
+
+    { // different chunk dimensions fall back to read / write
+        auto target = _file.createDataset<float>("/Converted", _dims,
+                                                 {128, 128, 1});
+        EXPECT_FALSE(source.copyChunksTo(target));
+        const auto converted = target.readFullDataset<float>();
+        EXPECT_TRUE(std::equal(converted.begin(), converted.end(),
+                               data.begin()));
+        target.close();
+    }
+
+    { // different dimensions
+        auto target = _file.createDataset<int>("/Small", {64, 64, 4});
+        EXPECT_THROW(source.copyChunksTo(target),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+        target.close();
+    }
+    source.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, accessOptions) {
+    const size_t chunkBytes = 32 * 16 * 4 * sizeof(float);
+    { // explicit cache settings when creating the dataset
+        PLI::HDF5::DatasetCreateOptions options;
+        options.chunkDims = {32, 16, 4};
+        options.access.cacheBytes = 4 * chunkBytes;
+        options.access.cacheSlots = 1009;
+        options.access.preemption = 0.5;
+        auto dset = _file.createDataset<float>("/Image", _dims, options);
+        const auto access = dset.accessOptions();
+        EXPECT_TRUE(access.cacheBytes.value() == 4 * chunkBytes);
+        EXPECT_TRUE(access.cacheSlots.value() == 1009);
+        EXPECT_TRUE(access.preemption.value() == 0.5);
+        dset.close();
+    }
+
+    { // row sweep keeps all chunks of a row in the cache
+        PLI::HDF5::DatasetAccessOptions options;
+        options.accessPattern = PLI::HDF5::AccessPattern::RowSweep;
+        auto dset = _file.openDataset("/Image", options);
+        const auto access = dset.accessOptions();
+        EXPECT_TRUE(access.cacheBytes.value() == 8 * chunkBytes);
+        EXPECT_TRUE(access.cacheSlots.value() == 809);
+        EXPECT_TRUE(access.preemption.value() == 1.0);
+        dset.close();
+    }
+
+    { // tile sweep keeps the neighbouring chunks in the cache
+        PLI::HDF5::DatasetAccessOptions options;
+        options.accessPattern = PLI::HDF5::AccessPattern::TileSweep;
+        options.cacheSlots = 521;
+        auto dset = _file.openDataset("/Image", options);
+        const auto access = dset.accessOptions();
+        EXPECT_TRUE(access.cacheBytes.value() == 4 * chunkBytes);
+        EXPECT_TRUE(access.cacheSlots.value() == 521);
+        dset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, autoChunkDims) {
+    using PLI::HDF5::ChunkProfile;
+    const auto type = PLI::HDF5::Type::createType<float>();
+    PLI::HDF5::ChunkPolicy policy;
+    auto chunkDims = [&](const std::vector<size_t> &dims,
+                         const ChunkProfile profile,
+                         const int numProcesses = 1) {
+        policy.profile = profile;
+        return PLI::HDF5::Dataset::autoChunkDims(dims, type, policy,
+                                                 numProcesses);
+    };
+
+    using Dims = std::vector<size_t>;
+    EXPECT_TRUE(chunkDims({4096, 4096}, ChunkProfile::Tile) ==
+                Dims({512, 512}));
+    EXPECT_TRUE(chunkDims({4096, 4096}, ChunkProfile::RowScan) ==
+                Dims({64, 4096}));
+    EXPECT_TRUE(chunkDims({4096, 4096, 16}, ChunkProfile::Tile) ==
+                Dims({512, 512, 1}));
+    EXPECT_TRUE(chunkDims({4096, 4096, 16}, ChunkProfile::RowScan) ==
+                Dims({64, 4096, 1}));
+    EXPECT_TRUE(chunkDims({4096, 4096, 16}, ChunkProfile::ZColumn) ==
+                Dims({128, 128, 16}));
+    // A narrow dataset gets longer chunks
+    EXPECT_TRUE(chunkDims({100000, 50}, ChunkProfile::Tile) ==
+                Dims({5242, 50}));
+    // Small datasets are not padded
+    EXPECT_TRUE(chunkDims({128, 128, 4}, ChunkProfile::Tile) ==
+                Dims({128, 128, 1}));
+    EXPECT_TRUE(chunkDims({1000000}, ChunkProfile::RowScan) ==
+                Dims({262144}));
+    // Each process gets its own row of chunks
+    EXPECT_TRUE(chunkDims({1000, 1000}, ChunkProfile::Tile, 4) ==
+                Dims({250, 512}));
+
+    { // used by create if no chunk dimensions are given
+        PLI::HDF5::DatasetCreateOptions options;
+        options.chunkPolicy = PLI::HDF5::ChunkPolicy{ChunkProfile::RowScan,
+                                                     32 * 128 * sizeof(float)};
+        auto dset = _file.createDataset<float>("/Image", _dims, options);
+        EXPECT_TRUE(dset.isChunked());
+        EXPECT_TRUE(dset.chunkDims() == Dims({32, 128, 1}));
+        dset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, append) {
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {64, 64, 1};
+    options.maxDims = {128, 128, PLI::HDF5::UNLIMITED};
+    auto dset = _file.createDataset<int>("/Stack", {128, 128, 0}, options);
+    EXPECT_TRUE(dset.maxDims() == options.maxDims);
+
+    std::vector<int> section(128 * 128);
+    for (int i = 0; i < 3; ++i) {
+        std::fill(section.begin(), section.end(), i);
+        dset.append(section, 2);
+    }
+    EXPECT_TRUE(dset.dims() == std::vector<size_t>({128, 128, 3}));
+    const auto data = dset.readFullDataset<int>();
+    for (size_t i = 0; i < data.size(); ++i) {
+        EXPECT_EQ(data[i], static_cast<int>(i % 3));
+    }
+
+    // Two sections at once
+    dset.append(std::vector<int>(2 * 128 * 128, 7), 2);
+    EXPECT_TRUE(dset.dims() == std::vector<size_t>({128, 128, 5}));
+    EXPECT_THROW(dset.append(std::vector<int>(100), 2),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    EXPECT_THROW(dset.append(section, 3),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    // The first dimensions are limited
+    EXPECT_THROW(dset.extend({256, 128, 5}),
+                 PLI::HDF5::Exceptions::HDF5RuntimeException);
+    dset.extend({128, 128, 2});
+    EXPECT_TRUE(dset.dims() == std::vector<size_t>({128, 128, 2}));
+    dset.close();
+
+    { // extendible datasets have to be chunked
+        PLI::HDF5::DatasetCreateOptions contiguous;
+        contiguous.maxDims = {128, 128, PLI::HDF5::UNLIMITED};
+        EXPECT_THROW(_file.createDataset<int>("/Contiguous", _dims, contiguous),
+                     PLI::HDF5::Exceptions::HDF5RuntimeException);
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, readSpan) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+    auto dset = _file.createDataset<int>("/Image", _dims, _chunk_dims);
+    dset.write(data, offset, _dims);
+
+    { // caller-owned buffers
+        std::vector<int> buffer(data.size());
+        dset.readFullDataset(std::span<int>(buffer));
+        EXPECT_TRUE(buffer == data);
+
+        const PLI::HDF5::Dataset::Hyperslab hyperslab(
+            std::vector<size_t>{32, 0, 0}, std::vector<size_t>{16, 128, 4});
+        std::vector<int> part(16 * 128 * 4);
+        dset.read(std::span<int>(part), hyperslab);
+        EXPECT_TRUE(part == dset.read<int>(hyperslab));
+        EXPECT_THROW(dset.read(std::span<int>(part).first(10), hyperslab),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+        EXPECT_THROW(dset.readFullDataset(std::span<int>(part)),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+    }
+
+    { // vectors without zero initialization
+        PLI::HDF5::DefaultInitVector<int> full =
+            dset.readFullDataset<int, PLI::HDF5::DefaultInitAllocator<int>>();
+        EXPECT_TRUE(std::equal(full.begin(), full.end(), data.begin(),
+                               data.end()));
+        PLI::HDF5::DefaultInitVector<int> part =
+            dset.read<int, PLI::HDF5::DefaultInitAllocator<int>>(
+                std::vector<size_t>{0, 0, 0}, std::vector<size_t>{1, 1, 4});
+        EXPECT_TRUE(part == PLI::HDF5::DefaultInitVector<int>({0, 1, 2, 3}));
+    }
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, metadata) {
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {64, 64, 1};
+    options.maxDims = {128, 128, PLI::HDF5::UNLIMITED};
+    auto dset = _file.createDataset<int>("/Stack", {128, 128, 2}, options);
+    auto copy = dset;
+    EXPECT_TRUE(copy.dims() == std::vector<size_t>({128, 128, 2}));
+    EXPECT_TRUE(copy.chunkDims() == options.chunkDims);
+    EXPECT_TRUE(copy.type() == PLI::HDF5::Type::createType<int>());
+
+    // Copies share the cached metadata
+    dset.extend({128, 128, 4});
+    EXPECT_TRUE(dset.dims() == std::vector<size_t>({128, 128, 4}));
+    EXPECT_TRUE(copy.dims() == std::vector<size_t>({128, 128, 4}));
+    EXPECT_TRUE(copy.maxDims() == options.maxDims);
+
+    // Repeated reads and writes reuse the cached handles
+    const std::vector<int> tile(8 * 8, 3);
+    for (size_t i = 0; i < 16; ++i) {
+        dset.write(tile, {i * 8, 0, 3}, {8, 8, 1});
+        EXPECT_TRUE(dset.read<int>({i * 8, 0, 3}, {8, 8, 1}) == tile);
+    }
+    dset.close();
+    copy.close();
+
+    { // contiguous datasets
+        auto contiguous = _file.createDataset<float>("/Contiguous", _dims, {});
+        EXPECT_FALSE(contiguous.isChunked());
+        EXPECT_THROW(contiguous.chunkDims(),
+                     PLI::HDF5::Exceptions::HDF5RuntimeException);
+        contiguous.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, typeTraits) {
+    { // complex numbers
+        std::vector<std::complex<float>> data(16);
+        for (size_t i = 0; i < data.size(); ++i) {
+            data[i] = std::complex<float>(i, -static_cast<float>(i));
+        }
+        auto dset = _file.createDataset<std::complex<float>>("/Complex",
+                                                             {4, 4}, {});
+        dset.write(data, {0, 0}, {4, 4});
+        EXPECT_TRUE(dset.readFullDataset<std::complex<float>>() == data);
+        // Stored as compound of the real and imaginary part
+        EXPECT_TRUE(H5Tget_class(dset.type()) == H5T_COMPOUND);
+        dset.close();
+    }
+    { // booleans
+        const std::vector<bool> values{true, false, false, true};
+        std::array<bool, 4> data;
+        std::copy(values.begin(), values.end(), data.begin());
+        auto dset =
+            _file.createDataset<bool>("/Mask", {4}, {});
+        dset.write<bool>(data.data(), {0}, {4});
+        const auto mask = dset.readFullDataset<char>();
+        EXPECT_TRUE(mask == std::vector<char>({1, 0, 0, 1}));
+        dset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, readMany) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    auto dset = _file.createDataset<int>("/Image", _dims, {32, 32, 4});
+    dset.write(data, {0, 0, 0}, _dims);
+
+    const std::vector<PLI::HDF5::Dataset::Hyperslab> hyperslabs{
+        {{100, 100, 0}, {16, 16, 4}},
+        {{0, 0, 0}, {8, 8, 4}},
+        // overlaps the first two
+        {{4, 4, 1}, {100, 100, 2}},
+        // strided
+        {{1, 3, 0}, {10, 20, 2}, {5, 6, 3}},
+        // duplicate
+        {{0, 0, 0}, {8, 8, 4}},
+        // empty
+        {{0, 0, 0}, {0, 8, 4}}};
+    const auto result = dset.readMany<int>(hyperslabs);
+    EXPECT_TRUE(result.size() == hyperslabs.size());
+    for (size_t i = 0; i < hyperslabs.size(); ++i) {
+        EXPECT_TRUE(result[i] == dset.read<int>(hyperslabs[i]));
+    }
+
+    { // caller-owned buffers
+        std::vector<float> first(16 * 16 * 4);
+        std::vector<float> second(8 * 8 * 4);
+        const std::vector<std::span<float>> outputs{first, second};
+        dset.readMany<float>(std::span(hyperslabs).first(2), outputs);
+        EXPECT_TRUE(first == dset.read<float>(hyperslabs[0]));
+        EXPECT_TRUE(second == dset.read<float>(hyperslabs[1]));
+        EXPECT_THROW(dset.readMany<float>(hyperslabs, outputs),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+    }
+
+    const std::vector<PLI::HDF5::Dataset::Hyperslab> outOfBounds{
+        {{120, 0, 0}, {16, 16, 4}}};
+    EXPECT_THROW(dset.readMany<int>(outOfBounds),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, readPoints) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    auto dset = _file.createDataset<int>("/Image", _dims, {32, 32, 4});
+    dset.write(data, {0, 0, 0}, _dims);
+
+    auto linearIndex = [this](size_t x, size_t y, size_t z) {
+        return static_cast<int>((x * _dims[1] + y) * _dims[2] + z);
+    };
+    // Unordered, spread over several chunks and with a duplicate
+    const std::vector<size_t> coordinates{127, 127, 3, 0,  0,  0,  64, 5, 1,
+                                          0,   0,   0, 33, 90, 2,  1,  2, 3};
+    const auto points = dset.readPoints<int>(coordinates);
+    const std::vector<int> expected{
+        linearIndex(127, 127, 3), linearIndex(0, 0, 0),  linearIndex(64, 5, 1),
+        linearIndex(0, 0, 0),     linearIndex(33, 90, 2), linearIndex(1, 2, 3)};
+    EXPECT_TRUE(points == expected);
+
+    std::vector<double> converted(6);
+    dset.readPoints(std::span<double>(converted), coordinates);
+    EXPECT_TRUE(std::equal(converted.begin(), converted.end(), points.begin()));
+
+    EXPECT_TRUE(dset.readPoints<int>(std::vector<size_t>{}).empty());
+    EXPECT_THROW(dset.readPoints<int>(std::vector<size_t>{1, 2}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    EXPECT_THROW(dset.readPoints<int>(std::vector<size_t>{128, 0, 0}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, mapReadOnly) {
+    std::vector<float> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                            std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0.0f);
+
+    { // contiguous datasets are mapped
+        auto dset = _file.createDataset<float>("/Contiguous", _dims, {});
+        dset.write(data, {0, 0, 0}, _dims);
+        const auto view = dset.mapReadOnly<float>();
+        EXPECT_TRUE(view.isMapped());
+        EXPECT_TRUE(view.dims() == _dims);
+        EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin(),
+                               data.end()));
+        EXPECT_TRUE(view.at({1, 2, 3}) == data[(1 * 128 + 2) * 4 + 3]);
+        EXPECT_THROW(view.at({128, 0, 0}),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+
+        // Other types are converted by HDF5
+        const auto converted = dset.mapReadOnly<double>();
+        EXPECT_FALSE(converted.isMapped());
+        EXPECT_TRUE(std::equal(converted.begin(), converted.end(),
+                               data.begin(), data.end()));
+        dset.close();
+    }
+
+    { // chunked datasets are read with HDF5
+        auto dset = _file.createDataset<float>("/Chunked", _dims, {32, 32, 4});
+        dset.write(data, {0, 0, 0}, _dims);
+        const auto view =
+            dset.mapReadOnly<float>(PLI::HDF5::MapAdvice::Sequential);
+        EXPECT_FALSE(view.isMapped());
+        EXPECT_TRUE(std::equal(view.begin(), view.end(), data.begin(),
+                               data.end()));
+        dset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, writeAsync) {
+    auto dset = _file.createDataset<float>("/Image", _dims, {32, 32, 4});
+    std::vector<float> tile(32 * 32 * 4);
+    std::vector<PLI::HDF5::IOHandle> handles;
+    for (size_t row = 0; row < 4; ++row) {
+        // The copied tile can be reused immediately.
+        std::fill(tile.begin(), tile.end(), static_cast<float>(row));
+        const PLI::HDF5::Dataset::Hyperslab hyperslab({row * 32, 0, 0},
+                                                      {32, 32, 4});
+        handles.push_back(dset.writeAsync(tile, hyperslab));
+    }
+    auto shared =
+        std::make_shared<const std::vector<float>>(32 * 32 * 4, 10.0f);
+    handles.push_back(dset.writeAsync(
+        shared, PLI::HDF5::Dataset::Hyperslab({0, 32, 0}, {32, 32, 4})));
+    const std::vector<float> borrowed(32 * 32 * 4, 20.0f);
+    handles.push_back(dset.writeAsync(
+        borrowed, PLI::HDF5::Dataset::Hyperslab({0, 64, 0}, {32, 32, 4}),
+        PLI::HDF5::AsyncBuffer::Borrow));
+    shared.reset();
+    _file.waitAll();
+    for (const auto &handle : handles) {
+        EXPECT_TRUE(handle.ready());
+        EXPECT_NO_THROW(handle.wait());
+    }
+
+    const auto data = dset.readFullDataset<float>();
+    for (size_t row = 0; row < 4; ++row) {
+        EXPECT_TRUE(data[(row * 32 * 128 + 5 * 128) * 4] == row);
+    }
+    EXPECT_TRUE(data[40 * 4] == 10.0f);
+    EXPECT_TRUE(data[70 * 4] == 20.0f);
+    EXPECT_TRUE(data[100 * 4] == 0.0f);
+
+    // Errors are reported by the handle.
+    auto handle = dset.writeAsync(
+        tile, PLI::HDF5::Dataset::Hyperslab({128, 0, 0}, {32, 32, 4}));
+    EXPECT_THROW(handle.wait(), PLI::HDF5::Exceptions::HDF5RuntimeException);
+    EXPECT_FALSE(PLI::HDF5::IOHandle().valid());
+
+    // The queue keeps the file identifier until the operation is finished.
+    // Operations only run in the background with a thread-safe library.
+    hbool_t threadSafe = false;
+    H5is_library_threadsafe(&threadSafe);
+    std::promise<void> release;
+    std::shared_future<void> released = release.get_future().share();
+    if (!threadSafe) {
+        release.set_value();
+    }
+    const int references = H5Iget_ref(_file);
+    auto pending = PLI::HDF5::IOQueue::getInstance()->submit(
+        _file, [released]() { released.wait(); });
+    if (threadSafe) {
+        EXPECT_EQ(H5Iget_ref(_file), references + 1);
+        release.set_value();
+    }
+    pending.wait();
+    _file.waitAll();
+    EXPECT_EQ(H5Iget_ref(_file), references);
+
+    // Closing the file waits for pending writes.
+    handle = dset.writeAsync(
+        tile, PLI::HDF5::Dataset::Hyperslab({96, 96, 0}, {32, 32, 4}));
+    dset.close();
+    _file.close();
+    EXPECT_TRUE(handle.ready());
+    EXPECT_NO_THROW(handle.wait());
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, chunkScheduler) {
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {32, 32, 4};
+    options.compression = PLI::HDF5::Compression::Deflate;
+    auto dset = _file.createDataset<float>("/Image", _dims, options);
+    std::vector<float> tile(32 * 64 * 4);
+    std::iota(tile.begin(), tile.end(), 0.0f);
+    dset.write(tile, PLI::HDF5::Dataset::Hyperslab({0, 0, 0}, {32, 64, 4}));
+    dset.write(std::vector<float>(32 * 32 * 4, 0.0f),
+               PLI::HDF5::Dataset::Hyperslab({32, 0, 0}, {32, 32, 4}));
+
+    // Only the three written chunks are processed.
+    std::vector<size_t> processed;
+    PLI::HDF5::forEachChunk<float>(
+        dset,
+        [&processed](const PLI::HDF5::Chunk<float> &chunk) {
+            processed.push_back(chunk.index);
+            EXPECT_EQ(chunk.data.size(), 32 * 32 * 4);
+        },
+        {.schedule = PLI::HDF5::ChunkSchedule::Static,
+         .skipUnallocated = true});
+    EXPECT_EQ(processed, std::vector<size_t>({0, 1, 4}));
+
+    // Allocation is unknown for other grids.
+    PLI::HDF5::ChunkScheduler scheduler(dset, dset.chunkGrid({64, 64, 4}),
+                                        {.skipUnallocated = true});
+    EXPECT_EQ(scheduler.size(), 4);
+    EXPECT_EQ(scheduler.assignedChunks(), std::vector<size_t>({0, 1, 3, 2}));
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset_Non_MPI, bufferedWriter) {
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {32, 32, 4};
+    options.compression = PLI::HDF5::Compression::Deflate;
+    auto dset = _file.createDataset<float>("/Image", _dims, options);
+    const auto row = [](const size_t y) {
+        std::vector<float> data(128 * 4);
+        std::iota(data.begin(), data.end(), float(y * 1000));
+        return data;
+    };
+    const size_t chunkBytes = 32 * 32 * 4 * sizeof(float);
+
+    {
+        PLI::HDF5::BufferedWriter<float> writer(dset);
+        EXPECT_EQ(writer.grid().size(), 16);
+        // Chunks are written as soon as all of their rows are buffered.
+        for (size_t y = 0; y < 31; ++y) {
+            writer.write(row(y),
+                         PLI::HDF5::Dataset::Hyperslab({y, 0, 0}, {1, 128, 4}));
+        }
+        EXPECT_EQ(writer.bufferedChunks(), 4);
+        EXPECT_EQ(writer.bufferedBytes(), 4 * chunkBytes);
+        writer.write(row(31),
+                     PLI::HDF5::Dataset::Hyperslab({31, 0, 0}, {1, 128, 4}));
+        EXPECT_EQ(writer.bufferedChunks(), 0);
+        EXPECT_EQ(writer.bufferedBytes(), 0);
+
+        // Incomplete chunks are written on flush.
+        writer.write(row(32),
+                     PLI::HDF5::Dataset::Hyperslab({32, 0, 0}, {1, 128, 4}));
+        writer.flush();
+        EXPECT_EQ(writer.bufferedChunks(), 0);
+
+        EXPECT_THROW(writer.write(row(0), PLI::HDF5::Dataset::Hyperslab(
+                                              {0, 0, 0}, {1, 64, 4})),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+        EXPECT_THROW(writer.write(row(0), PLI::HDF5::Dataset::Hyperslab(
+                                              {128, 0, 0}, {1, 128, 4})),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+    }
+
+    {
+        // The memory limit flushes the oldest chunks before they are
+        // complete. Their content is merged with the dataset.
+        PLI::HDF5::BufferedWriter<float> writer(dset, 2 * chunkBytes);
+        for (size_t y = 33; y < 64; ++y) {
+            writer.write(row(y),
+                         PLI::HDF5::Dataset::Hyperslab({y, 0, 0}, {1, 128, 4}));
+            EXPECT_LE(writer.bufferedBytes(), 2 * chunkBytes);
+        }
+        EXPECT_EQ(writer.bufferedChunks(), 2);
+        // Remaining chunks are written on destruction.
+        writer.write(row(64),
+                     PLI::HDF5::Dataset::Hyperslab({64, 0, 0}, {1, 128, 4}));
+    }
+
+    const auto data = dset.readFullDataset<float>();
+    for (size_t y = 0; y < 128; ++y) {
+        const auto expected = y <= 64 ? row(y) : std::vector<float>(128 * 4);
+        EXPECT_TRUE(std::equal(expected.begin(), expected.end(),
+                               data.begin() + y * 128 * 4))
+            << "row " << y;
+    }
+    dset.close();
+
+    // A chunk row larger than the memory limit flushes incomplete chunks of
+    // a dataset without storage.
+    auto fresh = _file.createDataset<int>("/Fresh", {8, 64}, {4, 8});
+    {
+        PLI::HDF5::BufferedWriter<int> writer(fresh, 2 * 4 * 8 * sizeof(int));
+        for (size_t y = 0; y < 3; ++y) {
+            const std::vector<int> values(64, int(y + 1));
+            EXPECT_NO_THROW(writer.write(
+                values, PLI::HDF5::Dataset::Hyperslab({y, 0}, {1, 64})));
+        }
+        writer.flush();
+        // Merges with unallocated chunks of a partially allocated dataset.
+        writer.write(std::vector<int>(8, 9),
+                     PLI::HDF5::Dataset::Hyperslab({5, 0}, {1, 8}));
+        writer.flush();
+    }
+    const auto freshData = fresh.readFullDataset<int>();
+    for (size_t y = 0; y < 8; ++y) {
+        for (size_t x = 0; x < 64; ++x) {
+            const int expected = y < 3 ? int(y + 1) : (y == 5 && x < 8 ? 9 : 0);
+            EXPECT_EQ(freshData[y * 64 + x], expected) << y << ", " << x;
+        }
+    }
+    fresh.close();
 }
 
 int main(int argc, char *argv[]) {
@@ -24,10 +24,19 @@
  */
 
 #include <gtest/gtest.h>
+#include <signal.h>
+#include <sys/wait.h>
+#include <unistd.h>
 
+#include <algorithm>
 #include <filesystem>
+#include <fstream>
 
+#include "PLIHDF5/attributes.h"
+#include "PLIHDF5/config.h"
+#include "PLIHDF5/dataset.h"
 #include "PLIHDF5/file.h"
+#include "PLIHDF5/group.h"
 
 void removeFile(const std::string &path) {
     if (std::filesystem::exists(path))
@@ -186,6 +195,296 @@ TEST_F(PLI_HDF5_File_Non_MPI, FaplID) {
     h5f.close();
 }
 
+TEST_F(PLI_HDF5_File_Non_MPI, AccessOptions) {
+    PLI::HDF5::FileAccessOptions options;
+    options.alignmentThreshold = 4096;
+    options.alignment = 1024 * 1024;
+    options.metadataBlockSize = 64 * 1024;
+    auto h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        options);
+
+    hsize_t threshold, alignment, blockSize;
+    ASSERT_GE(H5Pget_alignment(h5f.faplID(), &threshold, &alignment), 0);
+    ASSERT_EQ(threshold, 4096);
+    ASSERT_EQ(alignment, 1024 * 1024);
+    ASSERT_GE(H5Pget_meta_block_size(h5f.faplID(), &blockSize), 0);
+    ASSERT_EQ(blockSize, 64 * 1024);
+    h5f.close();
+
+    h5f = PLI::HDF5::openFile(_filePath, PLI::HDF5::File::OpenState::ReadOnly,
+                              {}, options);
+    ASSERT_GE(H5Pget_alignment(h5f.faplID(), &threshold, &alignment), 0);
+    ASSERT_EQ(alignment, 1024 * 1024);
+    h5f.close();
+}
+
+TEST_F(PLI_HDF5_File_Non_MPI, AccessOptionsFromConfig) {
+    const std::string configPath =
+        std::filesystem::temp_directory_path() / "test_file_access.json";
+    {
+        std::ofstream configFile(configPath);
+        configFile << R"({
+            "file_access": {
+                "mpi_hints": {
+                    "striping_factor": 16,
+                    "romio_cb_write": "enable"
+                },
+                "collective_metadata_reads": true,
+                "alignment": 65536,
+                "metadata_block_size": 8192
+            }
+        })";
+    }
+    auto *config = PLI::HDF5::Config::getInstance();
+    const std::string previousPath = config->getConfigFilePath();
+    config->setConfigFilePath(configPath);
+
+    auto options = config->getFileAccessOptions();
+    ASSERT_EQ(options.mpiHints.size(), 2);
+    ASSERT_EQ(options.mpiHints["striping_factor"], "16");
+    ASSERT_EQ(options.mpiHints["romio_cb_write"], "enable");
+    ASSERT_TRUE(options.collectiveMetadataReads.value_or(false));
+    ASSERT_FALSE(options.collectiveMetadataWrites.has_value());
+    ASSERT_FALSE(options.alignmentThreshold.has_value());
+    ASSERT_EQ(options.alignment.value_or(0), 65536);
+
+    // Without explicit options, the config file is used.
+    auto h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting);
+    hsize_t threshold, alignment;
+    ASSERT_GE(H5Pget_alignment(h5f.faplID(), &threshold, &alignment), 0);
+    ASSERT_EQ(threshold, 1);
+    ASSERT_EQ(alignment, 65536);
+    h5f.close();
+
+    // The section is only read once.
+    {
+        std::ofstream configFile(configPath);
+        configFile << "{";
+    }
+    h5f = PLI::HDF5::createFile(_filePath,
+                                PLI::HDF5::File::CreateState::OverrideExisting);
+    ASSERT_GE(H5Pget_alignment(h5f.faplID(), &threshold, &alignment), 0);
+    ASSERT_EQ(alignment, 65536);
+    h5f.close();
+
+    config->setConfigFilePath(previousPath);
+    removeFile(configPath);
+}
+
+TEST_F(PLI_HDF5_File_Non_MPI, PagedAggregation) {
+    PLI::HDF5::FileCreateOptions createOptions;
+    createOptions.pagedAggregation = true;
+    createOptions.pageSize = 64 * 1024;
+    PLI::HDF5::FileAccessOptions accessOptions;
+    accessOptions.pageBufferSize = 1024 * 1024;
+    auto h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        accessOptions, createOptions);
+    auto group = h5f.createGroup("group");
+    PLI::HDF5::AttributeHandler(group).createAttribute<int>("attr", 42);
+    group.close();
+
+    hid_t fcplID = H5Fget_create_plist(h5f.id());
+    H5F_fspace_strategy_t strategy;
+    hbool_t persist;
+    hsize_t threshold, pageSize;
+    ASSERT_GE(
+        H5Pget_file_space_strategy(fcplID, &strategy, &persist, &threshold),
+        0);
+    ASSERT_EQ(strategy, H5F_FSPACE_STRATEGY_PAGE);
+    ASSERT_GE(H5Pget_file_space_page_size(fcplID, &pageSize), 0);
+    ASSERT_EQ(pageSize, 64 * 1024);
+    H5Pclose(fcplID);
+    h5f.close();
+
+    size_t bufferSize;
+    unsigned minMetadata, minRawData;
+    h5f = PLI::HDF5::openFile(_filePath, PLI::HDF5::File::OpenState::ReadOnly,
+                              {}, accessOptions);
+    ASSERT_GE(H5Pget_page_buffer_size(h5f.faplID(), &bufferSize, &minMetadata,
+                                      &minRawData),
+              0);
+    ASSERT_EQ(bufferSize, 1024 * 1024);
+    group = h5f.openGroup("group");
+    ASSERT_EQ(PLI::HDF5::AttributeHandler(group).getAttribute<int>("attr")[0],
+              42);
+    group.close();
+    h5f.close();
+
+    // Files without paged aggregation are opened without page buffer.
+    h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        PLI::HDF5::FileAccessOptions{});
+    h5f.close();
+    ASSERT_NO_THROW(h5f = PLI::HDF5::openFile(
+                        _filePath, PLI::HDF5::File::OpenState::ReadOnly, {},
+                        accessOptions));
+    ASSERT_GE(H5Pget_page_buffer_size(h5f.faplID(), &bufferSize, &minMetadata,
+                                      &minRawData),
+              0);
+    ASSERT_EQ(bufferSize, 0);
+    h5f.close();
+}
+
+TEST_F(PLI_HDF5_File_Non_MPI, InMemory) {
+    const std::vector<float> data = {1, 2, 3, 4, 5, 6};
+    auto h5f = PLI::HDF5::createInMemoryFile("in_memory.h5");
+    ASSERT_EQ(H5Pget_driver(h5f.faplID()), H5FD_CORE);
+    ASSERT_FALSE(h5f.usesMPIFileAccess());
+    auto dataset = h5f.createDataset<float>("data", {2, 3});
+    dataset.write(data, {0, 0}, {2, 3});
+    dataset.close();
+    ASSERT_FALSE(std::filesystem::exists("in_memory.h5"));
+
+    const std::vector<std::byte> image = h5f.toImage();
+    h5f.close();
+    ASSERT_GT(image.size(), data.size() * sizeof(float));
+
+    auto imageFile = PLI::HDF5::openFileImage(image);
+    auto imageDataset = imageFile.openDataset("data");
+    auto readData = imageDataset.readFullDataset<float>();
+    ASSERT_TRUE(std::equal(data.begin(), data.end(), readData.begin()));
+    imageDataset.close();
+
+    // Changes of an opened image do not affect the image itself.
+    auto writableFile = PLI::HDF5::openFileImage(
+        image, PLI::HDF5::File::OpenState::ReadWrite);
+    writableFile.createGroup("group").close();
+    ASSERT_TRUE(PLI::HDF5::Group::exists(writableFile, "group"));
+    ASSERT_FALSE(PLI::HDF5::Group::exists(imageFile, "group"));
+    writableFile.close();
+    imageFile.close();
+
+    // Images of files on disk contain the file content.
+    h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        PLI::HDF5::FileAccessOptions{});
+    h5f.createGroup("group").close();
+    const std::vector<std::byte> diskImage = h5f.toImage();
+    h5f.close();
+    ASSERT_EQ(diskImage.size(), std::filesystem::file_size(_filePath));
+}
+
+TEST_F(PLI_HDF5_File_Non_MPI, InMemoryBackingStore) {
+    auto h5f = PLI::HDF5::createInMemoryFile(_filePath, 64 * 1024, true);
+    h5f.createGroup("group").close();
+    h5f.close();
+
+    ASSERT_TRUE(PLI::HDF5::File::isHDF5(_filePath));
+    h5f = PLI::HDF5::openFile(_filePath, PLI::HDF5::File::OpenState::ReadOnly,
+                              {}, PLI::HDF5::FileAccessOptions{});
+    ASSERT_TRUE(PLI::HDF5::Group::exists(h5f, "group"));
+    h5f.close();
+}
+
+TEST_F(PLI_HDF5_File_Non_MPI, SWMR) {
+    // HDF5 cannot open a file twice with different flags in one process, so
+    // the reader runs in a child process synchronized by pipes.
+    // The guard closes the open pipe ends and kills and reaps the reader when
+    // the test returns, also if an assertion fails while the reader waits.
+    struct Reader {
+        int toReader[2] = {-1, -1};
+        int toWriter[2] = {-1, -1};
+        pid_t pid = -1;
+
+        static void closeEnd(int &fd) {
+            if (fd >= 0) {
+                close(fd);
+                fd = -1;
+            }
+        }
+
+        ~Reader() {
+            for (int &fd : toReader) {
+                closeEnd(fd);
+            }
+            for (int &fd : toWriter) {
+                closeEnd(fd);
+            }
+            if (pid > 0) {
+                kill(pid, SIGKILL);
+                waitpid(pid, nullptr, 0);
+            }
+        }
+    } reader;
+    ASSERT_EQ(pipe(reader.toReader), 0);
+    ASSERT_EQ(pipe(reader.toWriter), 0);
+    char signal = 0;
+
+    reader.pid = fork();
+    ASSERT_GE(reader.pid, 0);
+    if (reader.pid == 0) {
+        // The child leaves with _exit, so the guard is not run here.
+        Reader::closeEnd(reader.toReader[1]);
+        Reader::closeEnd(reader.toWriter[0]);
+        const auto finish = [&reader](const int status) {
+            Reader::closeEnd(reader.toReader[0]);
+            Reader::closeEnd(reader.toWriter[1]);
+            _exit(status);
+        };
+        int status = 1;
+        try {
+            // Wait until the writer started SWMR mode.
+            if (read(reader.toReader[0], &signal, 1) != 1) {
+                finish(status);
+            }
+            auto file = PLI::HDF5::openFile(
+                _filePath, PLI::HDF5::File::OpenState::SWMRRead, {},
+                PLI::HDF5::FileAccessOptions{});
+            auto dataset = file.openDataset("data");
+            bool valid = file.usesSWMR() && dataset.dims()[0] == 4;
+            if (write(reader.toWriter[1], "r", 1) != 1 ||
+                read(reader.toReader[0], &signal, 1) != 1) {
+                finish(status);
+            }
+            dataset.refresh();
+            auto data = dataset.readFullDataset<int>();
+            valid = valid && dataset.dims()[0] == 8 && data.size() == 8 &&
+                    data[7] == 7;
+            status = valid ? 0 : 2;
+        } catch (...) {
+        }
+        finish(status);
+    }
+    Reader::closeEnd(reader.toReader[0]);
+    Reader::closeEnd(reader.toWriter[1]);
+
+    PLI::HDF5::FileCreateOptions createOptions;
+    createOptions.swmr = true;
+    auto h5f = PLI::HDF5::createFile(
+        _filePath, PLI::HDF5::File::CreateState::OverrideExisting, {},
+        PLI::HDF5::FileAccessOptions{}, createOptions);
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {4};
+    options.maxDims = {PLI::HDF5::UNLIMITED};
+    auto dataset = h5f.createDataset<int>("data", {4}, options);
+    dataset.write(std::vector<int>{0, 1, 2, 3}, {0}, {4});
+    ASSERT_FALSE(h5f.usesSWMR());
+    h5f.startSWMRWrite();
+    ASSERT_TRUE(h5f.usesSWMR());
+    dataset.flush();
+    ASSERT_EQ(write(reader.toReader[1], "s", 1), 1);
+
+    // Extend the dataset after the reader opened it.
+    ASSERT_EQ(read(reader.toWriter[0], &signal, 1), 1);
+    dataset.append(std::vector<int>{4, 5, 6, 7}, 0);
+    dataset.flush();
+    ASSERT_EQ(write(reader.toReader[1], "e", 1), 1);
+    Reader::closeEnd(reader.toReader[1]);
+    Reader::closeEnd(reader.toWriter[0]);
+
+    int status;
+    const pid_t pid = reader.pid;
+    ASSERT_EQ(waitpid(pid, &status, 0), pid);
+    reader.pid = -1;
+    ASSERT_TRUE(WIFEXITED(status));
+    ASSERT_EQ(WEXITSTATUS(status), 0);
+    dataset.close();
+    h5f.close();
+}
+
 int main(int argc, char *argv[]) {
     int result = 0;
 
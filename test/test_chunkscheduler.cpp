@@ -0,0 +1,175 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <numeric>
+#include <set>
+
+#include "PLIHDF5/chunkscheduler.h"
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/file.h"
+
+class PLI_HDF5_ChunkScheduler : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+        try {
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+        _file = PLI::HDF5::createFile(
+            _filePath, PLI::HDF5::File::CreateState::OverrideExisting,
+            MPI_COMM_WORLD);
+    }
+
+    void TearDown() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        try {
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    const std::vector<size_t> _dims{{64, 48}};
+    const std::vector<size_t> _chunkDims{{16, 16}};
+    const std::string _filePath = std::filesystem::temp_directory_path() /
+                                  "test_chunkscheduler.h5";
+    PLI::HDF5::File _file;
+};
+
+TEST_F(PLI_HDF5_ChunkScheduler, hilbertIndex) {
+    EXPECT_EQ(PLI::HDF5::ChunkScheduler::hilbertIndex(2, 0, 0), 0);
+    EXPECT_EQ(PLI::HDF5::ChunkScheduler::hilbertIndex(2, 0, 1), 1);
+    EXPECT_EQ(PLI::HDF5::ChunkScheduler::hilbertIndex(2, 1, 1), 2);
+    EXPECT_EQ(PLI::HDF5::ChunkScheduler::hilbertIndex(2, 1, 0), 3);
+
+    // Every cell is visited once and consecutive cells are neighbours.
+    const uint64_t order = 8;
+    std::vector<std::pair<uint64_t, uint64_t>> curve(order * order);
+    for (uint64_t x = 0; x < order; ++x) {
+        for (uint64_t y = 0; y < order; ++y) {
+            const uint64_t index =
+                PLI::HDF5::ChunkScheduler::hilbertIndex(order, x, y);
+            ASSERT_LT(index, curve.size());
+            curve[index] = {x + 1, y + 1};
+        }
+    }
+    for (size_t i = 1; i < curve.size(); ++i) {
+        const uint64_t dx = curve[i].first > curve[i - 1].first
+                                ? curve[i].first - curve[i - 1].first
+                                : curve[i - 1].first - curve[i].first;
+        const uint64_t dy = curve[i].second > curve[i - 1].second
+                                ? curve[i].second - curve[i - 1].second
+                                : curve[i - 1].second - curve[i].second;
+        EXPECT_EQ(dx + dy, 1);
+    }
+}
+
+TEST_F(PLI_HDF5_ChunkScheduler, forEachChunk) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    auto dset = _file.createDataset<int>("/Image", _dims, _chunkDims);
+    // Each process writes its own rows.
+    const size_t rows = _dims[0] / size;
+    const PLI::HDF5::Dataset::Hyperslab hyperslab(
+        std::vector<size_t>{rank * rows, 0},
+        std::vector<size_t>{rank == size - 1 ? _dims[0] - rank * rows : rows,
+                            _dims[1]});
+    std::vector<int> data(hyperslab.count()[0] * hyperslab.count()[1]);
+    std::iota(data.begin(), data.end(),
+              static_cast<int>(hyperslab.offset()[0] * _dims[1]));
+    dset.write(data, hyperslab);
+
+    for (const auto schedule : {PLI::HDF5::ChunkSchedule::Static,
+                                PLI::HDF5::ChunkSchedule::Hilbert,
+                                PLI::HDF5::ChunkSchedule::WorkStealing}) {
+        PLI::HDF5::ChunkScheduler scheduler(dset, {.schedule = schedule});
+        EXPECT_EQ(scheduler.schedule(), schedule);
+        EXPECT_EQ(scheduler.size(), 12);
+
+        std::vector<int> processed(scheduler.size(), 0);
+        std::vector<size_t> order;
+        PLI::HDF5::forEachChunk<int>(
+            dset, scheduler, [&](const PLI::HDF5::Chunk<int> &chunk) {
+                ++processed[chunk.index];
+                order.push_back(chunk.index);
+                const auto &offset = chunk.hyperslab.offset();
+                const auto &count = chunk.hyperslab.count();
+                ASSERT_EQ(chunk.data.size(), count[0] * count[1]);
+                EXPECT_EQ(chunk.data.front(),
+                          static_cast<int>(offset[0] * _dims[1] + offset[1]));
+            });
+        if (schedule != PLI::HDF5::ChunkSchedule::WorkStealing) {
+            EXPECT_EQ(order, scheduler.assignedChunks());
+        } else {
+            EXPECT_TRUE(scheduler.assignedChunks().empty());
+        }
+        EXPECT_FALSE(scheduler.next().has_value());
+
+        // Every chunk is processed by exactly one process.
+        MPI_Allreduce(MPI_IN_PLACE, processed.data(),
+                      static_cast<int>(processed.size()), MPI_INT, MPI_SUM,
+                      MPI_COMM_WORLD);
+        EXPECT_EQ(processed, std::vector<int>(scheduler.size(), 1));
+    }
+
+    { // Hilbert order of a single process
+        if (size == 1) {
+            PLI::HDF5::ChunkScheduler scheduler(dset);
+            EXPECT_EQ(scheduler.assignedChunks(),
+                      std::vector<size_t>(
+                          {0, 3, 4, 1, 2, 5, 8, 11, 10, 7, 6, 9}));
+        }
+    }
+    dset.close();
+}
+
+int main(int argc, char *argv[]) {
+    int result = 0;
+
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+    MPI_Finalize();
+    return result;
+}
@@ -25,10 +25,13 @@
 
 #include <gtest/gtest.h>
 
+#include <algorithm>
+#include <array>
 #include <cmath>
 #include <filesystem>
 #include <iostream>
 #include <limits>
+#include <ranges>
 
 #include "PLIHDF5/dataset.h"
 #include "PLIHDF5/file.h"
@@ -361,6 +364,357 @@ TEST_F(PLI_HDF5_Dataset, readLimit) {
     }
 }
 
+TEST_F(PLI_HDF5_Dataset, collective) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // The last rank does not write or read anything if more than one process
+    // is used. It still has to take part in every collective call.
+    const size_t writingRanks = size > 1 ? size - 1 : 1;
+    const size_t rows = _dims[0] / writingRanks;
+    const size_t rowElements = _dims[1] * _dims[2];
+    std::vector<size_t> offset{{rows * rank, 0, 0}};
+    std::vector<size_t> count{{rows, _dims[1], _dims[2]}};
+    if (static_cast<size_t>(rank) >= writingRanks) {
+        offset[0] = 0;
+        count[0] = 0;
+    } else if (static_cast<size_t>(rank) == writingRanks - 1) {
+        count[0] = _dims[0] - offset[0];
+    }
+    std::vector<int> data(count[0] * rowElements);
+    std::iota(data.begin(), data.end(), offset[0] * rowElements);
+
+    const std::vector<PLI::HDF5::TransferMode> modes{
+        PLI::HDF5::TransferMode::Collective,
+        PLI::HDF5::TransferMode::CollectiveLinkedChunks,
+        PLI::HDF5::TransferMode::CollectiveMultiChunk};
+    for (size_t i = 0; i < modes.size(); ++i) {
+        const std::string name = "/Image_" + std::to_string(i);
+        { // per-call transfer mode
+            auto dset = _file.createDataset<int>(name, _dims, _chunk_dims);
+            EXPECT_EQ(dset.transferMode(),
+                      PLI::HDF5::TransferMode::Independent);
+            EXPECT_NO_THROW(dset.write(data, offset, count, {}, modes[i]));
+            std::vector<int> data_in;
+            EXPECT_NO_THROW(data_in =
+                                dset.read<int>(offset, count, {}, modes[i]));
+            EXPECT_EQ(data_in, data);
+            dset.close();
+        }
+
+        { // default transfer mode of the file
+            _file.setTransferMode(modes[i]);
+            auto dset = _file.openDataset(name);
+            EXPECT_EQ(dset.transferMode(), modes[i]);
+            const PLI::HDF5::Dataset::Hyperslab hyperslab(offset, count);
+            std::vector<int> data_in;
+            EXPECT_NO_THROW(data_in = dset.read<int>(hyperslab));
+            EXPECT_EQ(data_in, data);
+            dset.close();
+            _file.setTransferMode(PLI::HDF5::TransferMode::Independent);
+        }
+    }
+}
+
+TEST_F(PLI_HDF5_Dataset, filters) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    const size_t rows = _dims[0] / size;
+    const size_t rowElements = _dims[1] * _dims[2];
+    std::vector<size_t> offset{{rows * rank, 0, 0}};
+    std::vector<size_t> count{{rows, _dims[1], _dims[2]}};
+    if (rank == size - 1) {
+        count[0] = _dims[0] - offset[0];
+    }
+    std::vector<float> data(count[0] * rowElements);
+    std::iota(data.begin(), data.end(), offset[0] * rowElements);
+
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {32, 128, 4};
+    options.shuffle = PLI::HDF5::Shuffle::Byte;
+    options.compression = PLI::HDF5::Compression::Deflate;
+    ASSERT_TRUE(PLI::HDF5::Dataset::filterAvailable(options.shuffle));
+    ASSERT_TRUE(PLI::HDF5::Dataset::filterAvailable(options.compression));
+
+    auto dset = _file.createDataset<float>("/Image", _dims, options);
+    EXPECT_EQ(dset.filters().size(), 2);
+    // Parallel writes to filtered datasets have to be collective.
+    EXPECT_NO_THROW(dset.write(data, offset, count, {},
+                               PLI::HDF5::TransferMode::Collective));
+    EXPECT_EQ(dset.read<float>(offset, count), data);
+    dset.close();
+
+    auto unfiltered = _file.createDataset<float>("/Raw", _dims, _chunk_dims);
+    EXPECT_TRUE(unfiltered.filters().empty());
+    unfiltered.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, copyChunksTo) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+    _file.setTransferMode(PLI::HDF5::TransferMode::Collective);
+    auto source = _file.createDataset<int>("/Source", _dims, {32, 64, 4});
+    source.write(data, offset, _dims);
+    auto target = _file.createDataset<int>("/Target", _dims, {32, 64, 4});
+    _file.setTransferMode(PLI::HDF5::TransferMode::Independent);
+
+    // Raw chunk access is not available with MPI. The chunks are distributed
+    // among all processes instead, each taking part in every collective call.
+    EXPECT_FALSE(source.copyChunksTo(target));
+    EXPECT_EQ(target.readFullDataset<int>(), data);
+    source.close();
+    target.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, append) {
+    PLI::HDF5::DatasetCreateOptions options;
+    options.chunkDims = {64, 64, 1};
+    options.maxDims = {128, 128, PLI::HDF5::UNLIMITED};
+    auto dset = _file.createDataset<int>("/Stack", {128, 128, 0}, options);
+
+    std::vector<int> section(128 * 128);
+    std::iota(section.begin(), section.end(), 0);
+    EXPECT_NO_THROW(
+        dset.append(section, 2, PLI::HDF5::TransferMode::Collective));
+    EXPECT_NO_THROW(dset.append(section, 2));
+    EXPECT_EQ(dset.dims(), std::vector<size_t>({128, 128, 2}));
+    EXPECT_EQ(dset.read<int>(std::vector<size_t>{0, 0, 1},
+                             std::vector<size_t>{128, 128, 1}),
+              section);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, readMany) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    auto dset = _file.createDataset<int>("/Image", _dims, {32, 32, 4});
+    if (rank == 0) {
+        dset.write(data, {0, 0, 0}, _dims);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    // Every process reads a different number of hyperslabs, the last one
+    // none at all.
+    std::vector<PLI::HDF5::Dataset::Hyperslab> hyperslabs;
+    if (rank != size - 1 || size == 1) {
+        for (int32_t i = 0; i <= rank; ++i) {
+            hyperslabs.emplace_back(
+                std::vector<size_t>{static_cast<size_t>(i) * 8, 16, 0},
+                std::vector<size_t>{8, 64, 4});
+        }
+    }
+    std::vector<std::vector<int>> result;
+    EXPECT_NO_THROW(result = dset.readMany<int>(
+                        hyperslabs, PLI::HDF5::TransferMode::Collective));
+    EXPECT_EQ(result.size(), hyperslabs.size());
+    for (size_t i = 0; i < result.size(); ++i) {
+        EXPECT_EQ(result[i], dset.read<int>(hyperslabs[i]));
+    }
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, writeAsync) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    // Every process writes its own rows of the dataset collectively.
+    auto dset = _file.createDataset<int>(
+        "/Image", {static_cast<size_t>(size) * 8, 64, 4}, {8, 64, 4});
+    const std::vector<int> rows(8 * 64 * 4, rank);
+    const PLI::HDF5::Dataset::Hyperslab hyperslab(
+        std::vector<size_t>{static_cast<size_t>(rank) * 8, 0, 0},
+        std::vector<size_t>{8, 64, 4});
+    auto handle = dset.writeAsync(rows, hyperslab, PLI::HDF5::AsyncBuffer::Copy,
+                                  PLI::HDF5::TransferMode::Collective);
+    _file.waitAll();
+    EXPECT_TRUE(handle.ready());
+    EXPECT_NO_THROW(handle.wait());
+    MPI_Barrier(MPI_COMM_WORLD);
+
+    EXPECT_EQ(dset.read<int>(hyperslab), rows);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, getChunks) {
+    auto dset = _file.createDataset<float>("/Image", _dims, _chunk_dims);
+    EXPECT_EQ(dset.getChunks().size(), 1);
+    EXPECT_EQ(dset.getChunks()[0],
+              PLI::HDF5::Dataset::Hyperslab(std::vector<size_t>{0, 0, 0},
+                                            _dims));
+
+    const auto chunks = dset.getChunks({48, 64, 4});
+    EXPECT_EQ(chunks.size(), 6);
+    EXPECT_EQ(chunks[5],
+              PLI::HDF5::Dataset::Hyperslab(std::vector<size_t>{96, 64, 0},
+                                            std::vector<size_t>{32, 64, 4}));
+    EXPECT_THROW(dset.getChunks({48, 64}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, chunkGrid) {
+    static_assert(std::random_access_iterator<PLI::HDF5::ChunkGrid::iterator>);
+    static_assert(std::ranges::random_access_range<PLI::HDF5::ChunkGrid>);
+
+    auto dset = _file.createDataset<float>("/Image", _dims, _chunk_dims);
+    const auto grid = dset.chunkGrid({48, 64, 4});
+    EXPECT_EQ(grid.size(), 6);
+    EXPECT_EQ(grid.gridDims(), std::vector<size_t>({3, 2, 1}));
+    EXPECT_EQ(grid.toVector(), dset.getChunks({48, 64, 4}));
+    EXPECT_EQ(grid[5],
+              PLI::HDF5::Dataset::Hyperslab(std::vector<size_t>{96, 64, 0},
+                                            std::vector<size_t>{32, 64, 4}));
+    EXPECT_THROW(grid.at(6), PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    EXPECT_EQ(grid.chunkCoordinates(3), std::vector<size_t>({1, 1, 0}));
+    EXPECT_EQ(grid.chunkIndex({1, 1, 0}), 3);
+    EXPECT_EQ(grid.chunkIndexOf({100, 10, 2}), 4);
+    EXPECT_THROW(grid.chunkIndexOf({128, 0, 0}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    size_t index = 0;
+    for (const auto &chunk : grid) {
+        EXPECT_EQ(grid.chunkIndexOf(chunk.offset()), index++);
+    }
+    EXPECT_EQ(index, grid.size());
+    EXPECT_EQ(*(grid.end() - 1), grid[5]);
+    EXPECT_EQ(std::ranges::distance(grid), 6);
+
+    EXPECT_TRUE(PLI::HDF5::ChunkGrid().empty());
+    EXPECT_THROW(dset.chunkGrid({48, 0, 4}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, chunks) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+    auto dset = _file.createDataset<int>("/Image", _dims, {48, 64, 4});
+    dset.write(data, offset, _dims);
+
+    for (const bool prefetch : {true, false}) {
+        auto range = dset.chunks<int>({}, prefetch);
+        EXPECT_EQ(range.size(), 6);
+        size_t numChunks = 0;
+        for (const auto &chunk : range) {
+            EXPECT_EQ(chunk.index, numChunks);
+            EXPECT_EQ(chunk.data, dset.read<int>(chunk.hyperslab));
+            ++numChunks;
+        }
+        EXPECT_EQ(numChunks, 6);
+    }
+
+    { // user defined chunk dimensions
+        size_t numElements = 0;
+        for (const auto &chunk : dset.chunks<int>({128, 128, 1})) {
+            EXPECT_EQ(chunk.data.size(), 128 * 128);
+            EXPECT_EQ(chunk.data[0], chunk.hyperslab.offset()[2]);
+            numElements += chunk.data.size();
+        }
+        EXPECT_EQ(numElements, data.size());
+    }
+    dset.close();
+}
+
+TEST_F(PLI_HDF5_Dataset, readWithHalo) {
+    std::vector<int> data(std::accumulate(_dims.begin(), _dims.end(), 1,
+                                          std::multiplies<std::size_t>()));
+    std::iota(data.begin(), data.end(), 0);
+    const std::vector<size_t> offset{{0, 0, 0}};
+    auto dset = _file.createDataset<int>("/Image", _dims, {32, 32, 4});
+    dset.write(data, offset, _dims);
+
+    // Expected element of the extended tile at (y, x, c).
+    const auto expected = [this](const PLI::HDF5::Dataset::Hyperslab &tile,
+                                 const std::vector<size_t> &halo,
+                                 const PLI::HDF5::BoundaryMode boundary,
+                                 long y, long x, long c) {
+        std::array<long, 3> position{
+            static_cast<long>(tile.offset()[0] - halo[0]) + y,
+            static_cast<long>(tile.offset()[1] - halo[1]) + x, c};
+        for (size_t i = 0; i < 2; ++i) {
+            const long size = static_cast<long>(_dims[i]);
+            if (position[i] >= 0 && position[i] < size) {
+                continue;
+            }
+            if (boundary == PLI::HDF5::BoundaryMode::Constant) {
+                return -1;
+            }
+            if (boundary == PLI::HDF5::BoundaryMode::Clamp) {
+                position[i] = std::clamp(position[i], 0l, size - 1);
+            } else {
+                position[i] = position[i] < 0 ? -position[i]
+                                              : 2 * (size - 1) - position[i];
+            }
+        }
+        return static_cast<int>((position[0] * 128 + position[1]) * 4 +
+                                position[2]);
+    };
+    const auto check = [&](const std::vector<int> &result,
+                           const PLI::HDF5::Dataset::Hyperslab &tile,
+                           const std::vector<size_t> &halo,
+                           const PLI::HDF5::BoundaryMode boundary) {
+        const long height = tile.count()[0] + 2 * halo[0];
+        const long width = tile.count()[1] + 2 * halo[1];
+        ASSERT_EQ(result.size(), height * width * 4);
+        for (long y = 0; y < height; ++y) {
+            for (long x = 0; x < width; ++x) {
+                for (long c = 0; c < 4; ++c) {
+                    ASSERT_EQ(result[(y * width + x) * 4 + c],
+                              expected(tile, halo, boundary, y, x, c));
+                }
+            }
+        }
+    };
+
+    const std::vector<size_t> halo{3, 5, 0};
+    for (const auto boundary : {PLI::HDF5::BoundaryMode::Clamp,
+                                PLI::HDF5::BoundaryMode::Mirror,
+                                PLI::HDF5::BoundaryMode::Constant}) {
+        for (const auto &tile :
+             {PLI::HDF5::Dataset::Hyperslab({0, 0, 0}, {16, 16, 4}),
+              PLI::HDF5::Dataset::Hyperslab({112, 40, 0}, {16, 16, 4}),
+              PLI::HDF5::Dataset::Hyperslab({32, 32, 0}, {16, 16, 4})}) {
+            check(dset.readWithHalo<int>(tile, halo, boundary, -1), tile, halo,
+                  boundary);
+        }
+    }
+    EXPECT_THROW(dset.readWithHalo<int>(
+                     PLI::HDF5::Dataset::Hyperslab({0, 0, 0}, {16, 16, 4}),
+                     {3, 3}),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    EXPECT_THROW(dset.readWithHalo<int>(
+                     PLI::HDF5::Dataset::Hyperslab({120, 0, 0}, {16, 16, 4}),
+                     halo),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    // Neighbouring chunks reuse the overlapping part of their halo.
+    for (const bool prefetch : {true, false}) {
+        size_t numChunks = 0;
+        for (const auto &chunk : dset.chunksWithHalo<int>(
+                 halo, PLI::HDF5::BoundaryMode::Mirror, 0, {}, prefetch)) {
+            check(chunk.data, chunk.hyperslab, halo,
+                  PLI::HDF5::BoundaryMode::Mirror);
+            ++numChunks;
+        }
+        EXPECT_EQ(numChunks, 16);
+    }
+    dset.close();
+}
+
 TEST_F(PLI_HDF5_Dataset, isChunked) {
     { // create dataset with chunks
         auto dset = _file.createDataset<float>("/Image", _dims, _chunk_dims);
@@ -535,6 +889,26 @@ TEST_F(PLI_HDF5_Dataset, hyperslab) {
         EXPECT_EQ(slices[1].stop, 1 + 3 * 2);
         EXPECT_EQ(slices[1].step, 2);
     }
+
+    { // inline storage
+        const auto hyperslab = PLI::HDF5::Dataset::Hyperslab(5, 3, 2);
+        EXPECT_EQ(hyperslab.offset(), std::vector<size_t>({5}));
+        EXPECT_EQ(hyperslab.count(), std::vector<size_t>({3}));
+        EXPECT_EQ(hyperslab.stride(), std::vector<size_t>({2}));
+
+        // More dimensions than stored inline
+        PLI::HDF5::Dataset::Hyperslab large;
+        for (size_t i = 0; i < 6; ++i) {
+            large.push_back(i, i + 1);
+        }
+        const std::vector<size_t> offset = large.offset();
+        EXPECT_EQ(offset, std::vector<size_t>({0, 1, 2, 3, 4, 5}));
+        EXPECT_EQ(large.count(), std::vector<size_t>({1, 2, 3, 4, 5, 6}));
+        EXPECT_EQ(large, PLI::HDF5::Dataset::Hyperslab(
+                             offset, {1, 2, 3, 4, 5, 6}, {1, 1, 1, 1, 1, 1}));
+        EXPECT_THROW(PLI::HDF5::Dataset::Hyperslab(offset, {1, 2}),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+    }
 }
 
 int main(int argc, char *argv[]) {
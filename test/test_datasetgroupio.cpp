@@ -0,0 +1,174 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <filesystem>
+#include <numeric>
+
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/datasetgroupio.h"
+#include "PLIHDF5/file.h"
+
+class PLI_HDF5_DatasetGroupIO : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+        try {
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+        _file = PLI::HDF5::createFile(
+            _filePath, PLI::HDF5::File::CreateState::OverrideExisting,
+            MPI_COMM_WORLD);
+    }
+
+    void TearDown() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        try {
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    const std::vector<size_t> _dims{{64, 64}};
+    const std::vector<std::string> _names{"Transmittance", "Direction",
+                                          "Retardation", "Inclination"};
+    const std::string _filePath = std::filesystem::temp_directory_path() /
+                                  "test_datasetgroupio.h5";
+    PLI::HDF5::File _file;
+};
+
+TEST_F(PLI_HDF5_DatasetGroupIO, readWrite) {
+    int32_t rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    MPI_Comm_size(MPI_COMM_WORLD, &size);
+
+    PLI::HDF5::DatasetGroupIO maps;
+    for (const std::string &name : _names) {
+        maps.add(_file.createDataset<float>(name, _dims, {32, 32}));
+    }
+    EXPECT_EQ(maps.size(), _names.size());
+
+    // Each process writes its own rows to all maps at once.
+    const size_t rows = _dims[0] / size;
+    const PLI::HDF5::Dataset::Hyperslab hyperslab(
+        std::vector<size_t>{rank * rows, 0},
+        std::vector<size_t>{rank == size - 1 ? _dims[0] - rank * rows : rows,
+                            _dims[1]});
+    const size_t numElements = hyperslab.count()[0] * hyperslab.count()[1];
+    std::vector<std::vector<float>> data(_names.size(),
+                                         std::vector<float>(numElements));
+    for (size_t i = 0; i < data.size(); ++i) {
+        std::iota(data[i].begin(), data[i].end(), i * 1000.0f);
+    }
+    for (const auto mode : {PLI::HDF5::TransferMode::Independent,
+                            PLI::HDF5::TransferMode::Collective}) {
+        EXPECT_NO_THROW(maps.write(data, hyperslab, mode));
+        std::vector<std::vector<float>> result;
+        EXPECT_NO_THROW(result = maps.read<float>(hyperslab, mode));
+        EXPECT_EQ(result, data);
+        for (size_t i = 0; i < maps.size(); ++i) {
+            EXPECT_EQ(maps.datasets()[i].read<float>(hyperslab), data[i]);
+        }
+    }
+
+    { // caller-owned buffers with conversion
+        std::vector<std::vector<double>> buffers(
+            _names.size(), std::vector<double>(numElements));
+        std::vector<std::span<double>> outputs(buffers.begin(), buffers.end());
+        maps.read<double>(outputs, hyperslab);
+        for (size_t i = 0; i < buffers.size(); ++i) {
+            EXPECT_TRUE(std::equal(buffers[i].begin(), buffers[i].end(),
+                                   data[i].begin()));
+        }
+        outputs.pop_back();
+        EXPECT_THROW(maps.read<double>(outputs, hyperslab),
+                     PLI::HDF5::Exceptions::DimensionMismatchException);
+    }
+    EXPECT_THROW(maps.write(std::vector<std::vector<float>>(4), hyperslab),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    for (auto dataset : maps.datasets()) {
+        dataset.close();
+    }
+}
+
+TEST_F(PLI_HDF5_DatasetGroupIO, invalidHyperslab) {
+    PLI::HDF5::DatasetGroupIO maps;
+    maps.add(_file.createDataset<float>(_names[0], _dims, {32, 32}));
+    maps.add(_file.createDataset<float>(_names[1], {32, 64}, {32, 32}));
+    std::vector<std::vector<float>> data(2, std::vector<float>(64 * 64));
+
+    // The hyperslab exceeds the second dataset.
+    const PLI::HDF5::Dataset::Hyperslab rows(std::vector<size_t>{0, 0},
+                                             std::vector<size_t>{64, 64});
+    EXPECT_THROW(maps.write(data, rows),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+    EXPECT_THROW(maps.read<float>(rows),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    // The rank of the hyperslab does not match the datasets.
+    const PLI::HDF5::Dataset::Hyperslab column(std::vector<size_t>{0},
+                                               std::vector<size_t>{32});
+    EXPECT_THROW(maps.read<float>(column),
+                 PLI::HDF5::Exceptions::DimensionMismatchException);
+
+    // The datasets are left untouched and can still be accessed.
+    const PLI::HDF5::Dataset::Hyperslab block(std::vector<size_t>{0, 0},
+                                              std::vector<size_t>{32, 32});
+    for (auto &buffer : data) {
+        buffer.resize(32 * 32);
+    }
+    EXPECT_NO_THROW(maps.write(data, block));
+
+    for (auto dataset : maps.datasets()) {
+        dataset.close();
+    }
+}
+
+int main(int argc, char *argv[]) {
+    int result = 0;
+
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+    MPI_Finalize();
+    return result;
+}
@@ -0,0 +1,253 @@
+/*
+    MIT License
+
+    Copyright (c) 2022 Forschungszentrum Jülich / Jan André Reuter & Felix
+   Matuschke.
+
+    Permission is hereby granted, free of charge, to any person obtaining a copy
+    of this software and associated documentation files (the "Software"), to
+   deal in the Software without restriction, including without limitation the
+   rights to use, copy, modify, merge, publish, distribute, sublicense, and/or
+   sell copies of the Software, and to permit persons to whom the Software is
+    furnished to do so, subject to the following conditions:
+
+    The above copyright notice and this permission notice shall be included in
+   all copies or substantial portions of the Software.
+
+    THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+    IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+    FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+    AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+    LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+   FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS
+   IN THE SOFTWARE.
+ */
+
+#include <gtest/gtest.h>
+
+#include <cmath>
+#include <filesystem>
+#include <numeric>
+
+#include "PLIHDF5/dataset.h"
+#include "PLIHDF5/file.h"
+#include "PLIHDF5/group.h"
+#include "PLIHDF5/pyramid.h"
+
+class PLI_HDF5_Pyramid : public ::testing::Test {
+  protected:
+    void SetUp() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+
+        try {
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+        _file = PLI::HDF5::createFile(
+            _filePath, PLI::HDF5::File::CreateState::OverrideExisting,
+            MPI_COMM_WORLD);
+
+        _data.resize(_dims[0] * _dims[1]);
+        std::iota(_data.begin(), _data.end(), 0);
+        _source = _file.createDataset<int>("/Image", _dims, {16, 16});
+        if (rank == 0) {
+            _source.write(_data, std::vector<size_t>{0, 0}, _dims);
+        }
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    void TearDown() override {
+        int32_t rank;
+        MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+        try {
+            _source.close();
+            _file.close();
+        } catch (...) {
+            // can occur due to testing failures. leave pointer open and
+            // continue.
+        }
+        if (rank == 0 && std::filesystem::exists(_filePath))
+            std::filesystem::remove(_filePath);
+        MPI_Barrier(MPI_COMM_WORLD);
+    }
+
+    // Straightforward 2x2 mean of a 2D image.
+    static std::vector<int> halve(const std::vector<int> &data,
+                                  const std::vector<size_t> &dims) {
+        const size_t rows = (dims[0] + 1) / 2;
+        const size_t cols = (dims[1] + 1) / 2;
+        std::vector<int> result(rows * cols);
+        for (size_t r = 0; r < rows; ++r) {
+            for (size_t c = 0; c < cols; ++c) {
+                double sum = 0;
+                int count = 0;
+                for (size_t y = 2 * r; y < std::min(2 * r + 2, dims[0]); ++y) {
+                    for (size_t x = 2 * c; x < std::min(2 * c + 2, dims[1]);
+                         ++x) {
+                        sum += data[y * dims[1] + x];
+                        ++count;
+                    }
+                }
+                result[r * cols + c] = static_cast<int>(std::round(sum / count));
+            }
+        }
+        return result;
+    }
+
+    const std::vector<size_t> _dims{{100, 70}};
+    const std::string _filePath =
+        std::filesystem::temp_directory_path() / "test_pyramid.h5";
+    std::vector<int> _data;
+    PLI::HDF5::File _file;
+    PLI::HDF5::Dataset _source;
+};
+
+TEST_F(PLI_HDF5_Pyramid, levels) {
+    EXPECT_EQ(PLI::HDF5::Pyramid::numLevels({100000, 80000}, 256), 9);
+    EXPECT_EQ(PLI::HDF5::Pyramid::numLevels({256, 128}, 256), 0);
+    EXPECT_EQ(PLI::HDF5::Pyramid::levelDims({100, 70, 5}, 2),
+              std::vector<size_t>({25, 18, 5}));
+    EXPECT_EQ(PLI::HDF5::Pyramid::levelDims({100, 70, 5}, 2, true),
+              std::vector<size_t>({25, 18, 2}));
+    EXPECT_EQ(PLI::HDF5::Pyramid::levelName(0), "00");
+    EXPECT_EQ(PLI::HDF5::Pyramid::levelName(12), "12");
+}
+
+TEST_F(PLI_HDF5_Pyramid, reduce) {
+    { // 2x2 blocks of a 3D image with two channels
+        const std::vector<int> data{0, 10, 1, 11, 2, 12, //
+                                    3, 13, 4, 14, 5, 15};
+        PLI::HDF5::PyramidOptions options;
+        options.kernel = PLI::HDF5::PyramidKernel::Max;
+        EXPECT_EQ(PLI::HDF5::Pyramid(options).reduce(data, {2, 3, 2}),
+                  std::vector<int>({4, 14, 5, 15}));
+        options.kernel = PLI::HDF5::PyramidKernel::Nearest;
+        EXPECT_EQ(PLI::HDF5::Pyramid(options).reduce(data, {2, 3, 2}),
+                  std::vector<int>({0, 10, 2, 12}));
+        options.kernel = PLI::HDF5::PyramidKernel::Mean;
+        options.reduceDepth = true;
+        EXPECT_EQ(PLI::HDF5::Pyramid(options).reduce(data, {2, 3, 2}),
+                  std::vector<int>({7, 9}));
+    }
+
+    { // integer mean rounds half away from zero
+        EXPECT_EQ(PLI::HDF5::Pyramid().reduce(std::vector<int>{-3, 0, 1, 0},
+                                              {2, 2}),
+                  std::vector<int>({-1}));
+        EXPECT_EQ(PLI::HDF5::Pyramid().reduce(
+                      std::vector<unsigned char>{1, 2, 3, 4, 5, 6}, {2, 3}),
+                  std::vector<unsigned char>({3, 5}));
+    }
+
+    { // floating point mean
+        const std::vector<float> data{1, 2, 3, 4};
+        EXPECT_EQ(PLI::HDF5::Pyramid().reduce(data, {2, 2}),
+                  std::vector<float>({2.5}));
+    }
+}
+
+TEST_F(PLI_HDF5_Pyramid, build) {
+    auto group = _file.createGroup("/pyramid");
+    PLI::HDF5::PyramidOptions options;
+    options.levels = 3;
+    options.numThreads = 2;
+    auto levels = PLI::HDF5::Pyramid(options).build<int>(_source, group);
+    ASSERT_EQ(levels.size(), 4);
+    EXPECT_EQ(levels[0].readFullDataset<int>(), _data);
+
+    std::vector<int> expected = _data;
+    std::vector<size_t> dims = _dims;
+    for (size_t level = 1; level < levels.size(); ++level) {
+        expected = halve(expected, dims);
+        dims = PLI::HDF5::Pyramid::levelDims(dims, 1);
+        EXPECT_EQ(levels[level].dims(), dims);
+        EXPECT_TRUE(levels[level].isChunked());
+        // Compare against the in-memory reduction of the previous level to
+        // check the band borders.
+        EXPECT_EQ(levels[level].readFullDataset<int>(), expected);
+    }
+    EXPECT_TRUE(PLI::HDF5::Dataset::exists(group, "03"));
+
+    for (auto &level : levels) {
+        level.close();
+    }
+    EXPECT_THROW(PLI::HDF5::Pyramid(options).build<int>(_source, group),
+                 PLI::HDF5::Exceptions::DatasetExistsException);
+    group.close();
+}
+
+TEST_F(PLI_HDF5_Pyramid, linkFilteredSource) {
+    int32_t rank;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank);
+    // Raw chunks can only be copied without MPI-IO, so both files are opened
+    // by a single process.
+    if (rank == 0) {
+        const std::string sourcePath =
+            std::filesystem::temp_directory_path() / "test_pyramid_source.h5";
+        const std::string pyramidPath =
+            std::filesystem::temp_directory_path() / "test_pyramid_link.h5";
+        auto sourceFile = PLI::HDF5::createFile(
+            sourcePath, PLI::HDF5::File::CreateState::OverrideExisting);
+        auto pyramidFile = PLI::HDF5::createFile(
+            pyramidPath, PLI::HDF5::File::CreateState::OverrideExisting);
+
+        PLI::HDF5::DatasetCreateOptions options;
+        options.chunkDims = {16, 16};
+        options.shuffle = PLI::HDF5::Shuffle::Byte;
+        options.compression = PLI::HDF5::Compression::Deflate;
+        options.compressionLevel = 6;
+        options.fletcher32 = true;
+        auto source = sourceFile.createDataset(
+            "/Image", _dims, options, PLI::HDF5::Type::createType<int>());
+        source.write(_data, std::vector<size_t>{0, 0}, _dims);
+
+        // The source is in another file and is copied to level "00".
+        auto group = pyramidFile.createGroup("/pyramid");
+        PLI::HDF5::PyramidOptions pyramidOptions;
+        pyramidOptions.levels = 1;
+        auto levels =
+            PLI::HDF5::Pyramid(pyramidOptions).build<int>(source, group);
+        ASSERT_EQ(levels.size(), 2);
+        EXPECT_EQ(levels[0].filters(), source.filters());
+        EXPECT_EQ(levels[0].chunkDims(), source.chunkDims());
+        EXPECT_EQ(levels[0].readFullDataset<int>(), _data);
+        // The chunks were copied as stored, without decompressing them.
+        for (const auto &chunk : source.getChunks()) {
+            const std::vector<size_t> offset(chunk.offset().begin(),
+                                             chunk.offset().end());
+            const auto expected = source.readRawChunk(offset);
+            const auto copied = levels[0].readRawChunk(offset);
+            EXPECT_FALSE(copied.data.empty());
+            EXPECT_EQ(copied.data, expected.data);
+            EXPECT_EQ(copied.filterMask, expected.filterMask);
+        }
+
+        for (auto &level : levels) {
+            level.close();
+        }
+        group.close();
+        source.close();
+        pyramidFile.close();
+        sourceFile.close();
+        std::filesystem::remove(sourcePath);
+        std::filesystem::remove(pyramidPath);
+    }
+    MPI_Barrier(MPI_COMM_WORLD);
+}
+
+int main(int argc, char *argv[]) {
+    int result = 0;
+
+    MPI_Init(&argc, &argv);
+    ::testing::InitGoogleTest(&argc, argv);
+    result = RUN_ALL_TESTS();
+
+    MPI_Finalize();
+    return result;
+}
@@ -25,23 +25,77 @@
 
 #include <gtest/gtest.h>
 
+#include <array>
+#include <complex>
 #include <string>
 
 #include "PLIHDF5/type.h"
 
+struct TypeTestPoint {
+    float x;
+    double y;
+    std::array<int, 3> index;
+};
+PLI_HDF5_COMPOUND_TYPE(TypeTestPoint, PLI_HDF5_MEMBER(TypeTestPoint, x),
+                       PLI_HDF5_MEMBER(TypeTestPoint, y),
+                       PLI_HDF5_MEMBER(TypeTestPoint, index))
+
 template <typename T> class TypeTest : public ::testing::Test {
   protected:
     TypeTest() : m_type(PLI::HDF5::Type::createType<T>()) {}
     PLI::HDF5::Type m_type;
 };
-typedef ::testing::Types<uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t,
-                         int32_t, int64_t, float, double>
+typedef ::testing::Types<bool, char, uint8_t, uint16_t, uint32_t, uint64_t,
+                         int8_t, int16_t, int32_t, int64_t, long long, float,
+                         double, long double, std::complex<float>,
+                         std::complex<double>, std::array<float, 4>,
+                         TypeTestPoint>
     TestTypes;
 
 TYPED_TEST_SUITE(TypeTest, TestTypes);
 
 TYPED_TEST(TypeTest, CreateType) {
     EXPECT_TRUE(PLI::HDF5::Type::createType<TypeParam>() == this->m_type);
+    // No new identifier is created on repeated calls
+    EXPECT_EQ(hid_t(PLI::HDF5::Type::createType<TypeParam>()),
+              hid_t(this->m_type));
+    EXPECT_EQ(H5Tget_size(this->m_type), sizeof(TypeParam));
+}
+
+TEST(Type, NativeTypes) {
+    EXPECT_TRUE(PLI::HDF5::Type::createType<uint16_t>() ==
+                PLI::HDF5::Type("H5T_NATIVE_USHORT"));
+    EXPECT_TRUE(PLI::HDF5::Type::createType<int64_t>() ==
+                PLI::HDF5::Type("H5T_NATIVE_LLONG"));
+    EXPECT_TRUE(PLI::HDF5::Type::createType<float>() ==
+                PLI::HDF5::Type("H5T_NATIVE_FLOAT"));
+    EXPECT_TRUE(PLI::HDF5::Type::createType<const double>() ==
+                PLI::HDF5::Type::createType<double>());
+}
+
+TEST(Type, CompoundTypes) {
+    const PLI::HDF5::Type complexType =
+        PLI::HDF5::Type::createType<std::complex<double>>();
+    EXPECT_EQ(H5Tget_class(complexType), H5T_COMPOUND);
+    EXPECT_EQ(H5Tget_nmembers(complexType), 2);
+    EXPECT_EQ(H5Tget_member_index(complexType, "r"), 0);
+    EXPECT_EQ(H5Tget_member_index(complexType, "i"), 1);
+
+    const PLI::HDF5::Type arrayType =
+        PLI::HDF5::Type::createType<std::array<float, 4>>();
+    EXPECT_EQ(H5Tget_class(arrayType), H5T_ARRAY);
+    hsize_t arrayDims[1];
+    EXPECT_EQ(H5Tget_array_dims2(arrayType, arrayDims), 1);
+    EXPECT_EQ(arrayDims[0], 4);
+
+    const PLI::HDF5::Type pointType =
+        PLI::HDF5::Type::createType<TypeTestPoint>();
+    EXPECT_EQ(H5Tget_class(pointType), H5T_COMPOUND);
+    EXPECT_EQ(H5Tget_nmembers(pointType), 3);
+    EXPECT_EQ(H5Tget_member_offset(pointType, 1), offsetof(TypeTestPoint, y));
+    hid_t indexType = H5Tget_member_type(pointType, 2);
+    EXPECT_EQ(H5Tget_class(indexType), H5T_ARRAY);
+    H5Tclose(indexType);
 }
 
 int main(int argc, char *argv[]) {